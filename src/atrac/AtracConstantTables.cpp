@@ -0,0 +1,1862 @@
+// Generated by src/main_generate_tables.cpp, do not edit. Run `make tables`.
+
+#include "AtracConstantTables.h"
+
+namespace Atrac3 {
+
+  const float kEncodingScalingWindow[kNumSamplesPerSubband] = {
+    9.41753387e-06f, 8.46982002e-05f, 0.000235289335f, 0.000461131334f, 0.000762224197f, 0.00113847852f,
+    0.00158986449f, 0.00211629272f, 0.00271770358f, 0.00339403749f, 0.00414511561f, 0.00497090816f,
+    0.00587120652f, 0.00684595108f, 0.00789496303f, 0.00901806355f, 0.0102151036f, 0.0114859343f,
+    0.012830317f, 0.0142480433f, 0.0157389641f, 0.0173027813f, 0.0189392865f, 0.0206482708f,
+    0.0224294066f, 0.0242824852f, 0.0262072086f, 0.0282032788f, 0.0302703977f, 0.0324082375f,
+    0.0346165299f, 0.0368948877f, 0.0392429829f, 0.0416604578f, 0.0441469848f, 0.0467021465f,
+    0.0493255854f, 0.0520168841f, 0.0547756255f, 0.0576014519f, 0.0604938865f, 0.063452512f,
+    0.0664768815f, 0.0695665479f, 0.0727210045f, 0.0759398341f, 0.0792225003f, 0.0825685859f,
+    0.0859774947f, 0.08944875f, 0.0929818451f, 0.0965762138f, 0.100231379f, 0.103946716f,
+    0.107721686f, 0.111555785f, 0.115448326f, 0.119398832f, 0.123406589f, 0.127471119f,
+    0.131591707f, 0.135767817f, 0.139998764f, 0.144283891f, 0.148622632f, 0.153014272f,
+    0.157458186f, 0.161953658f, 0.166500032f, 0.171096653f, 0.175742805f, 0.180437803f,
+    0.185180873f, 0.189971417f, 0.194808602f, 0.199691772f, 0.204620153f, 0.209593028f,
+    0.214609653f, 0.219669223f, 0.224771023f, 0.229914248f, 0.235098183f, 0.240322024f,
+    0.245584965f, 0.250886172f, 0.25622493f, 0.261600435f, 0.267011762f, 0.272458196f,
+    0.277938962f, 0.283453107f, 0.288999856f, 0.294578433f, 0.300187945f, 0.305827469f,
+    0.311496317f, 0.317193508f, 0.322918296f, 0.328669637f, 0.334446847f, 0.340249002f,
+    0.346075177f, 0.351924568f, 0.357796252f, 0.363689363f, 0.369602948f, 0.375536203f,
+    0.381488234f, 0.387458026f, 0.393444836f, 0.399447709f, 0.405465662f, 0.411497891f,
+    0.417543471f, 0.423601449f, 0.42967087f, 0.435750961f, 0.441840708f, 0.447939187f,
+    0.454045534f, 0.460158825f, 0.466278076f, 0.472402394f, 0.478530884f, 0.484662622f,
+    0.490796626f, 0.49693206f, 0.50306797f, 0.509203434f, 0.515337408f, 0.521469176f,
+    0.527597666f, 0.533721983f, 0.539841235f, 0.545954525f, 0.552060843f, 0.558159351f,
+    0.564249098f, 0.570329189f, 0.576398611f, 0.582456589f, 0.588502169f, 0.594534397f,
+    0.60055232f, 0.606555164f, 0.612542033f, 0.618511796f, 0.624463797f, 0.630397081f,
+    0.636310697f, 0.642203808f, 0.648075461f, 0.653924882f, 0.659751058f, 0.665553212f,
+    0.671330392f, 0.677081764f, 0.682806492f, 0.688503742f, 0.694172561f, 0.699812114f,
+    0.705421627f, 0.711000085f, 0.716546893f, 0.722061098f, 0.727541804f, 0.732988298f,
+    0.738399684f, 0.743775129f, 0.749113798f, 0.754415035f, 0.759678006f, 0.764901876f,
+    0.770085812f, 0.775229037f, 0.780330777f, 0.785390377f, 0.790406942f, 0.795379877f,
+    0.800308287f, 0.805191457f, 0.810028672f, 0.814819098f, 0.819562197f, 0.824257195f,
+    0.828903377f, 0.833500028f, 0.838046432f, 0.842541933f, 0.846985698f, 0.851377368f,
+    0.855716109f, 0.860001266f, 0.864232183f, 0.868408322f, 0.872528911f, 0.876593351f,
+    0.880601168f, 0.884551644f, 0.888444245f, 0.892278314f, 0.896053314f, 0.89976871f,
+    0.903423786f, 0.907018185f, 0.91055131f, 0.914022565f, 0.917431474f, 0.920777559f,
+    0.924060225f, 0.927278996f, 0.930433512f, 0.933523118f, 0.936547518f, 0.939506173f,
+    0.942398548f, 0.945224404f, 0.947983146f, 0.950674415f, 0.953297853f, 0.955853045f,
+    0.958339572f, 0.960757017f, 0.963105142f, 0.96538347f, 0.967591763f, 0.969729662f,
+    0.971796751f, 0.973792791f, 0.975717545f, 0.977570653f, 0.979351759f, 0.981060743f,
+    0.982697248f, 0.984261036f, 0.985751987f, 0.987169743f, 0.988514066f, 0.989784896f,
+    0.990981936f, 0.992105007f, 0.993154049f, 0.994128823f, 0.995029092f, 0.995854855f,
+    0.996605992f, 0.997282267f, 0.997883677f, 0.998410165f, 0.998861551f, 0.999237776f,
+    0.999538898f, 0.999764681f, 0.999915302f, 0.999990582f, 0.999990582f, 0.999915302f,
+    0.999764681f, 0.999538898f, 0.999237776f, 0.998861551f, 0.998410106f, 0.997883677f,
+    0.997282267f, 0.996605992f, 0.995854855f, 0.995029092f, 0.994128823f, 0.993154049f,
+    0.992105007f, 0.990981936f, 0.989784837f, 0.988514066f, 0.987169683f, 0.985751927f,
+    0.984261036f, 0.982697248f, 0.981060684f, 0.979351699f, 0.977570593f, 0.975717545f,
+    0.973792791f, 0.971796751f, 0.969729602f, 0.967591763f, 0.96538341f, 0.963105083f,
+    0.960757017f, 0.958339512f, 0.955852985f, 0.953297853f, 0.950674415f, 0.947983086f,
+    0.945224404f, 0.942398548f, 0.939506054f, 0.936547458f, 0.933523059f, 0.930433393f,
+    0.927278936f, 0.924060166f, 0.92077744f, 0.917431414f, 0.914022505f, 0.91055119f,
+    0.907018125f, 0.903423727f, 0.899768591f, 0.896053314f, 0.892278314f, 0.888444185f,
+    0.884551644f, 0.880601168f, 0.876593351f, 0.872528911f, 0.868408263f, 0.864232183f,
+    0.860001206f, 0.85571605f, 0.851377308f, 0.846985638f, 0.842541814f, 0.838046312f,
+    0.833499908f, 0.828903317f, 0.824257255f, 0.819562256f, 0.814819098f, 0.810028553f,
+    0.805191398f, 0.800308228f, 0.795379758f, 0.790406942f, 0.785390258f, 0.780330658f,
+    0.775228858f, 0.770085573f, 0.764901638f, 0.759678006f, 0.754415095f, 0.749113858f,
+    0.74377507f, 0.738399625f, 0.732988238f, 0.727541745f, 0.722061038f, 0.716546834f,
+    0.711000025f, 0.705421448f, 0.699811995f, 0.694172382f, 0.688503563f, 0.682806551f,
+    0.677081823f, 0.671330392f, 0.665553153f, 0.659750998f, 0.653924763f, 0.648075402f,
+    0.642203689f, 0.636310577f, 0.630396962f, 0.624463677f, 0.618511677f, 0.612541795f,
+    0.606554985f, 0.60055238f, 0.594534338f, 0.588502109f, 0.582456529f, 0.576398551f,
+    0.57032907f, 0.564248979f, 0.558159232f, 0.552060723f, 0.545954347f, 0.539841115f,
+    0.533721805f, 0.527597427f, 0.521468937f, 0.515337467f, 0.509203374f, 0.50306797f,
+    0.49693203f, 0.490796596f, 0.484662563f, 0.478530794f, 0.472402304f, 0.466277927f,
+    0.460158646f, 0.454045385f, 0.447939038f, 0.441840529f, 0.435750991f, 0.42967093f,
+    0.423601419f, 0.417543441f, 0.411497861f, 0.405465633f, 0.39944762f, 0.393444777f,
+    0.387457967f, 0.381488085f, 0.375536084f, 0.369602799f, 0.363689184f, 0.357796073f,
+    0.351924598f, 0.346075207f, 0.340249002f, 0.334446847f, 0.328669608f, 0.322918177f,
+    0.317193449f, 0.311496228f, 0.305827379f, 0.300187796f, 0.294578314f, 0.288999736f,
+    0.283452928f, 0.277938783f, 0.272458255f, 0.267011762f, 0.261600375f, 0.25622493f,
+    0.250886142f, 0.245584875f, 0.240321964f, 0.235098124f, 0.229914188f, 0.224770904f,
+    0.219669104f, 0.214609504f, 0.209592879f, 0.204620004f, 0.199691802f, 0.194808602f,
+    0.189971387f, 0.185180873f, 0.180437744f, 0.175742745f, 0.171096593f, 0.166499972f,
+    0.161953568f, 0.157458067f, 0.153014183f, 0.148622513f, 0.144283772f, 0.139998615f,
+    0.135767817f, 0.131591737f, 0.127471089f, 0.123406589f, 0.119398773f, 0.115448296f,
+    0.111555725f, 0.107721657f, 0.103946656f, 0.10023129f, 0.0965761244f, 0.0929817259f,
+    0.0894486308f, 0.0859773755f, 0.0825685859f, 0.0792225003f, 0.0759398341f, 0.0727210045f,
+    0.0695665181f, 0.0664768517f, 0.0634524822f, 0.0604938269f, 0.0576013923f, 0.0547755659f,
+    0.0520167947f, 0.049325496f, 0.0467020571f, 0.0441469848f, 0.0416604877f, 0.0392429829f,
+    0.0368948877f, 0.0346165001f, 0.0324082375f, 0.0302703679f, 0.028203249f, 0.0262071788f,
+    0.0242824554f, 0.0224293768f, 0.0206482112f, 0.0189392567f, 0.0173027217f, 0.0157389641f,
+    0.0142480433f, 0.012830317f, 0.0114859343f, 0.0102151036f, 0.00901806355f, 0.00789493322f,
+    0.00684595108f, 0.00587120652f, 0.00497087836f, 0.00414511561f, 0.00339400768f, 0.00271770358f,
+    0.00211626291f, 0.00158986449f, 0.00113847852f, 0.000762194395f, 0.000461131334f, 0.000235289335f,
+    8.46982002e-05f, 9.41753387e-06f,
+  };
+
+  const float kDecodingScalingWindow[kNumSamplesPerSubband] = {
+    9.41771123e-06f, 8.47125484e-05f, 0.00023540009f, 0.000461556774f, 0.000763387012f, 0.00114107365f,
+    0.00159492809f, 0.00212526927f, 0.0027325158f, 0.00341715454f, 0.00417962251f, 0.00502057327f,
+    0.00594055327f, 0.00694032712f, 0.00802060775f, 0.00918218121f, 0.0104259327f, 0.0117528178f,
+    0.0131637733f, 0.0146598397f, 0.0162421875f, 0.0179119073f, 0.0196702573f, 0.0215185657f,
+    0.0234581083f, 0.0254903622f, 0.0276167914f, 0.0298389178f, 0.0321583562f, 0.0345767476f,
+    0.0370958932f, 0.0397175066f, 0.0424434729f, 0.045275718f, 0.0482162498f, 0.0512670726f,
+    0.0544303432f, 0.0577082001f, 0.0611028522f, 0.064616695f, 0.0682520121f, 0.0720112324f,
+    0.0758968592f, 0.0799114183f, 0.0840574428f, 0.0883376673f, 0.092754744f, 0.0973114669f,
+    0.102010578f, 0.106854931f, 0.111847423f, 0.116990969f, 0.122288592f, 0.12774317f,
+    0.133357778f, 0.139135554f, 0.145079345f, 0.151192412f, 0.157477647f, 0.163938269f,
+    0.170577258f, 0.177397698f, 0.184402585f, 0.191594824f, 0.198977455f, 0.20655328f,
+    0.214325115f, 0.222295687f, 0.230467618f, 0.238843471f, 0.247425571f, 0.256216317f,
+    0.265217692f, 0.274431825f, 0.283860207f, 0.293504626f, 0.303366423f, 0.313446522f,
+    0.323745996f, 0.334265202f, 0.345004439f, 0.355963737f, 0.367142588f, 0.378540158f,
+    0.390155464f, 0.401986778f, 0.414032221f, 0.42628929f, 0.438754916f, 0.451425731f,
+    0.464297771f, 0.477366537f, 0.490626961f, 0.504073441f, 0.517699659f, 0.531498849f,
+    0.545463622f, 0.559585512f, 0.573856592f, 0.588267088f, 0.602807105f, 0.617466092f,
+    0.632232845f, 0.647095442f, 0.662041664f, 0.67705828f, 0.692131698f, 0.707248032f,
+    0.72239244f, 0.73755008f, 0.752705097f, 0.767841399f, 0.782943487f, 0.797994256f,
+    0.812976956f, 0.827874601f, 0.842669904f, 0.857345819f, 0.871884882f, 0.886270225f,
+    0.900484741f, 0.914511323f, 0.9283337f, 0.94193548f, 0.955300808f, 0.968413949f,
+    0.981260836f, 0.993826687f, 1.00609803f, 1.018062f, 1.02970612f, 1.04101908f,
+    1.05199039f, 1.06261063f, 1.07287073f, 1.08276272f, 1.09228015f, 1.10141683f,
+    1.11016726f, 1.11852837f, 1.12649691f, 1.13407052f, 1.14124835f, 1.14803016f,
+    1.15441668f, 1.16040933f, 1.16601062f, 1.17122424f, 1.17605376f, 1.18050408f,
+    1.18458068f, 1.18828976f, 1.19163775f, 1.19463253f, 1.19728148f, 1.19959319f,
+    1.20157611f, 1.20323908f, 1.20459187f, 1.20564377f, 1.20640492f, 1.20688534f,
+    1.20709515f, 1.20704496f, 1.20674455f, 1.20620513f, 1.20543635f, 1.20444942f,
+    1.20325434f, 1.20186138f, 1.20028102f, 1.19852293f, 1.19659722f, 1.19451332f,
+    1.19228125f, 1.18991041f, 1.18740976f, 1.18478799f, 1.18205416f, 1.17921662f,
+    1.1762836f, 1.17326331f, 1.17016327f, 1.16699111f, 1.16375422f, 1.16045916f,
+    1.15711284f, 1.15372181f, 1.1502924f, 1.14683056f, 1.14334214f, 1.13983238f,
+    1.13630676f, 1.13277042f, 1.12922788f, 1.12568414f, 1.12214351f, 1.11861014f,
+    1.11508811f, 1.11158109f, 1.10809278f, 1.10462677f, 1.10118628f, 1.09777427f,
+    1.09439385f, 1.09104788f, 1.08773875f, 1.08446932f, 1.08124161f, 1.07805812f,
+    1.07492089f, 1.07183194f, 1.06879306f, 1.06580615f, 1.06287253f, 1.05999434f,
+    1.05717266f, 1.05440891f, 1.05170453f, 1.0490607f, 1.04647851f, 1.04395902f,
+    1.04150331f, 1.03911233f, 1.03678668f, 1.03452766f, 1.03233564f, 1.03021133f,
+    1.0281558f, 1.0261693f, 1.02425241f, 1.02240574f, 1.02062988f, 1.01892519f,
+    1.01729202f, 1.01573086f, 1.01424205f, 1.01282585f, 1.01148283f, 1.0102129f,
+    1.00901663f, 1.00789392f, 1.00684536f, 1.00587082f, 1.00497055f, 1.00414503f,
+    1.00339401f, 1.00271773f, 1.00211632f, 1.00158989f, 1.00113845f, 1.00076222f,
+    1.0004611f, 1.00023532f, 1.00008476f, 1.00000942f, 1.00000942f, 1.00008476f,
+    1.00023532f, 1.0004611f, 1.00076222f, 1.00113845f, 1.00158989f, 1.00211632f,
+    1.00271773f, 1.00339401f, 1.00414503f, 1.00497055f, 1.00587082f, 1.00684536f,
+    1.00789392f, 1.00901663f, 1.0102129f, 1.01148283f, 1.01282597f, 1.01424205f,
+    1.01573086f, 1.01729202f, 1.01892519f, 1.02063f, 1.02240586f, 1.02425241f,
+    1.0261693f, 1.0281558f, 1.03021145f, 1.03233564f, 1.03452778f, 1.03678679f,
+    1.03911233f, 1.04150343f, 1.04395914f, 1.04647851f, 1.0490607f, 1.05170465f,
+    1.05440891f, 1.05717266f, 1.05999446f, 1.06287265f, 1.06580615f, 1.06879318f,
+    1.07183194f, 1.07492089f, 1.07805836f, 1.08124173f, 1.08446944f, 1.08773887f,
+    1.09104788f, 1.09439385f, 1.09777427f, 1.10118628f, 1.10462677f, 1.1080929f,
+    1.11158109f, 1.11508811f, 1.11861014f, 1.12214351f, 1.12568414f, 1.12922788f,
+    1.1327703f, 1.13630676f, 1.13983238f, 1.14334214f, 1.14683056f, 1.15029252f,
+    1.15372193f, 1.15711296f, 1.16045904f, 1.16375411f, 1.16699111f, 1.17016351f,
+    1.17326343f, 1.17628372f, 1.17921674f, 1.18205416f, 1.18478811f, 1.18740976f,
+    1.18991053f, 1.19228172f, 1.19451356f, 1.1965971f, 1.19852269f, 1.2002809f,
+    1.20186138f, 1.20325434f, 1.20444953f, 1.20543659f, 1.20620489f, 1.20674443f,
+    1.20704484f, 1.20709515f, 1.20688534f, 1.20640504f, 1.20564389f, 1.20459163f,
+    1.20323896f, 1.20157611f, 1.19959319f, 1.1972816f, 1.19463265f, 1.19163787f,
+    1.18828964f, 1.18458045f, 1.18050396f, 1.17605364f, 1.171224f, 1.16601086f,
+    1.16040921f, 1.15441632f, 1.14803016f, 1.14124835f, 1.13407052f, 1.12649691f,
+    1.11852849f, 1.11016738f, 1.10141647f, 1.09227991f, 1.08276272f, 1.07287049f,
+    1.06261039f, 1.05199027f, 1.04101896f, 1.029706f, 1.01806188f, 1.00609803f,
+    0.993826628f, 0.981260777f, 0.968414068f, 0.955300331f, 0.941935003f, 0.928333282f,
+    0.914510965f, 0.900484204f, 0.886269927f, 0.871884644f, 0.857345581f, 0.842669725f,
+    0.827874422f, 0.812976837f, 0.797994077f, 0.782943368f, 0.767841458f, 0.752704799f,
+    0.737549543f, 0.722392201f, 0.707247734f, 0.6921314f, 0.677057922f, 0.662041247f,
+    0.647095382f, 0.632232666f, 0.617465973f, 0.602807045f, 0.588267028f, 0.573856533f,
+    0.559585571f, 0.545463204f, 0.531498432f, 0.517699301f, 0.504073083f, 0.490626752f,
+    0.477366239f, 0.464297533f, 0.451425731f, 0.438754827f, 0.426289141f, 0.414032191f,
+    0.401986808f, 0.390155435f, 0.378540099f, 0.36714229f, 0.355963409f, 0.345004171f,
+    0.334264964f, 0.323745728f, 0.313446313f, 0.303366125f, 0.293504655f, 0.283860147f,
+    0.274431705f, 0.265217692f, 0.256216288f, 0.247425526f, 0.238843352f, 0.230467483f,
+    0.222295508f, 0.214324906f, 0.206553146f, 0.198977277f, 0.191594645f, 0.184402376f,
+    0.177397698f, 0.170577273f, 0.163938239f, 0.157477647f, 0.151192337f, 0.1450793f,
+    0.13913545f, 0.133357748f, 0.127743095f, 0.122288458f, 0.116990849f, 0.111847281f,
+    0.106854767f, 0.102010421f, 0.097311452f, 0.0927547216f, 0.0883376524f, 0.0840574354f,
+    0.0799113661f, 0.0758968219f, 0.0720111951f, 0.0682519376f, 0.064616628f, 0.0611027852f,
+    0.0577080958f, 0.0544302464f, 0.0512669794f, 0.0482162423f, 0.0452757441f, 0.0424434729f,
+    0.0397174992f, 0.0370958559f, 0.0345767476f, 0.0321583226f, 0.0298388861f, 0.0276167598f,
+    0.0254903324f, 0.0234580729f, 0.0215185005f, 0.0196702238f, 0.017911844f, 0.0162421875f,
+    0.0146598378f, 0.0131637715f, 0.0117528178f, 0.0104259308f, 0.00918218121f, 0.00802057795f,
+    0.00694032712f, 0.00594055327f, 0.00502054347f, 0.00417962251f, 0.00341712451f, 0.0027325158f,
+    0.00212523923f, 0.00159492786f, 0.00114107365f, 0.00076335721f, 0.000461556774f, 0.00023540009f,
+    8.47125484e-05f, 9.41771123e-06f,
+  };
+
+  const float kScaleFactors[kNumScaleFactors] = {
+    0.03125f, 0.0393725373f, 0.0496062785f, 0.0625f, 0.0787450746f, 0.0992125571f,
+    0.125f, 0.157490119f, 0.198425144f, 0.25f, 0.314980239f, 0.396850288f,
+    0.5f, 0.629960597f, 0.793700457f, 1.0f, 1.25992119f, 1.58740091f,
+    2.0f, 2.51984239f, 3.17480183f, 4.0f, 5.03968477f, 6.34960365f,
+    8.0f, 10.0793657f, 12.6992111f, 16.0f, 20.1587315f, 25.3984222f,
+    32.0f, 40.3174629f, 50.7968445f, 64.0f, 80.6349258f, 101.593689f,
+    128.0f, 161.269852f, 203.187378f, 256.0f, 322.539703f, 406.374756f,
+    512.0f, 645.079407f, 812.749512f, 1024.0f, 1290.15881f, 1625.49902f,
+    2048.0f, 2580.31934f, 3250.99585f, 4096.0f, 5160.63867f, 6501.9917f,
+    8192.0f, 10321.2773f, 13003.9834f, 16384.0f, 20642.5547f, 26007.9668f,
+    32768.0f, 41285.1094f, 52015.9336f, 65536.0f,
+  };
+
+  const float kGainCompensationLevels[kNumGainCompensationLevels] = {
+    16.0f, 8.0f, 4.0f, 2.0f, 1.0f, 0.5f,
+    0.25f, 0.125f, 0.0625f, 0.03125f, 0.015625f, 0.0078125f,
+    0.00390625f, 0.001953125f, 0.0009765625f, 0.00048828125f,
+  };
+
+  const float kGainCompensationRamps[kNumGainCompensationRampValues] = {
+    16.0f, 16.0f, 16.0f, 16.0f, 16.0f, 16.0f,
+    16.0f, 16.0f, 16.0f, 14.6720648f, 13.4543428f, 12.3376865f,
+    11.3137083f, 10.3747168f, 9.51365757f, 8.72406292f, 16.0f, 13.4543428f,
+    11.3137093f, 9.51365757f, 8.00000095f, 6.72717237f, 5.65685511f, 4.75682926f,
+    16.0f, 12.3376865f, 9.51365662f, 7.33603191f, 5.65685368f, 4.36203051f,
+    3.36358523f, 2.59367871f, 16.0f, 11.3137083f, 7.99999952f, 5.65685368f,
+    3.99999952f, 2.82842684f, 1.99999976f, 1.41421342f, 16.0f, 10.3747168f,
+    6.7271719f, 4.36203146f, 2.82842755f, 1.83400846f, 1.18920743f, 0.771105647f,
+    16.0f, 9.51365662f, 5.65685368f, 3.36358523f, 1.99999964f, 1.18920684f,
+    0.70710659f, 0.420448095f, 16.0f, 8.72406197f, 4.75682878f, 2.59367943f,
+    1.41421378f, 0.771105528f, 0.420448273f, 0.229251042f, 16.0f, 8.0f,
+    4.0f, 2.0f, 1.0f, 0.5f, 0.25f, 0.125f,
+    16.0f, 7.33603239f, 3.36358571f, 1.54221082f, 0.707106769f, 0.324209899f,
+    0.1486509f, 0.0681567416f, 16.0f, 6.72717142f, 2.82842731f, 1.1892072f,
+    0.50000006f, 0.210224137f, 0.088388361f, 0.0371627286f, 16.0f, 6.16884327f,
+    2.37841415f, 0.917003989f, 0.353553355f, 0.136313453f, 0.0525560193f, 0.0202631149f,
+    16.0f, 5.65685415f, 1.99999988f, 0.707106709f, 0.24999997f, 0.0883883387f,
+    0.0312499963f, 0.0110485423f, 16.0f, 5.18735838f, 1.68179297f, 0.545253932f,
+    0.176776722f, 0.0573127642f, 0.0185813662f, 0.00602426287f, 16.0f, 4.75682831f,
+    1.41421342f, 0.420448154f, 0.124999978f, 0.0371627137f, 0.0110485405f, 0.00328475074f,
+    16.0f, 4.36203098f, 1.1892072f, 0.324209929f, 0.088388361f, 0.0240970477f,
+    0.00656950427f, 0.00179102377f, 8.0f, 8.72406197f, 9.51365757f, 10.3747177f,
+    11.3137102f, 12.3376884f, 13.4543447f, 14.6720667f, 8.0f, 8.0f,
+    8.0f, 8.0f, 8.0f, 8.0f, 8.0f, 8.0f,
+    8.0f, 7.33603239f, 6.72717142f, 6.16884327f, 5.65685415f, 5.18735838f,
+    4.75682878f, 4.36203146f, 8.0f, 6.72717142f, 5.65685463f, 4.75682878f,
+    4.00000048f, 3.36358619f, 2.82842755f, 2.37841463f, 8.0f, 6.16884327f,
+    4.75682831f, 3.66801596f, 2.82842684f, 2.18101525f, 1.68179262f, 1.29683936f,
+    8.0f, 5.65685415f, 3.99999976f, 2.82842684f, 1.99999976f, 1.41421342f,
+    0.999999881f, 0.707106709f, 8.0f, 5.18735838f, 3.36358595f, 2.18101573f,
+    1.41421378f, 0.917004228f, 0.594603717f, 0.385552824f, 8.0f, 4.75682831f,
+    2.82842684f, 1.68179262f, 0.999999821f, 0.594603419f, 0.353553295f, 0.210224047f,
+    8.0f, 4.36203098f, 2.37841439f, 1.29683971f, 0.707106888f, 0.385552764f,
+    0.210224137f, 0.114625521f, 8.0f, 4.0f, 2.0f, 1.0f,
+    0.5f, 0.25f, 0.125f, 0.0625f, 8.0f, 3.6680162f,
+    1.68179286f, 0.771105409f, 0.353553385f, 0.162104949f, 0.0743254498f, 0.0340783708f,
+    8.0f, 3.36358571f, 1.41421366f, 0.594603598f, 0.25000003f, 0.105112068f,
+    0.0441941805f, 0.0185813643f, 8.0f, 3.08442163f, 1.18920708f, 0.458501995f,
+    0.176776677f, 0.0681567267f, 0.0262780096f, 0.0101315575f, 8.0f, 2.82842708f,
+    0.99999994f, 0.353553355f, 0.124999985f, 0.0441941693f, 0.0156249981f, 0.00552427117f,
+    8.0f, 2.59367919f, 0.840896487f, 0.272626966f, 0.088388361f, 0.0286563821f,
+    0.00929068308f, 0.00301213143f, 8.0f, 2.37841415f, 0.707106709f, 0.210224077f,
+    0.0624999888f, 0.0185813569f, 0.00552427024f, 0.00164237537f, 4.0f, 4.75682831f,
+    5.65685368f, 6.72717047f, 7.99999857f, 9.51365471f, 11.3137054f, 13.454339f,
+    4.0f, 4.36203098f, 4.75682878f, 5.18735886f, 5.65685511f, 6.16884422f,
+    6.72717237f, 7.33603334f, 4.0f, 4.0f, 4.0f, 4.0f,
+    4.0f, 4.0f, 4.0f, 4.0f, 4.0f, 3.6680162f,
+    3.36358571f, 3.08442163f, 2.82842708f, 2.59367919f, 2.37841439f, 2.18101573f,
+    4.0f, 3.36358571f, 2.82842731f, 2.37841439f, 2.00000024f, 1.68179309f,
+    1.41421378f, 1.18920732f, 4.0f, 3.08442163f, 2.37841415f, 1.83400798f,
+    1.41421342f, 1.09050763f, 0.840896308f, 0.648419678f, 4.0f, 2.82842708f,
+    1.99999988f, 1.41421342f, 0.999999881f, 0.707106709f, 0.49999994f, 0.353553355f,
+    4.0f, 2.59367919f, 1.68179297f, 1.09050786f, 0.707106888f, 0.458502114f,
+    0.297301859f, 0.192776412f, 4.0f, 2.37841415f, 1.41421342f, 0.840896308f,
+    0.499999911f, 0.29730171f, 0.176776648f, 0.105112024f, 4.0f, 2.18101549f,
+    1.1892072f, 0.648419857f, 0.353553444f, 0.192776382f, 0.105112068f, 0.0573127605f,
+    4.0f, 2.0f, 1.0f, 0.5f, 0.25f, 0.125f,
+    0.0625f, 0.03125f, 4.0f, 1.8340081f, 0.840896428f, 0.385552704f,
+    0.176776692f, 0.0810524747f, 0.0371627249f, 0.0170391854f, 4.0f, 1.68179286f,
+    0.707106829f, 0.297301799f, 0.125000015f, 0.0525560342f, 0.0220970903f, 0.00929068215f,
+    4.0f, 1.54221082f, 0.594603539f, 0.229250997f, 0.0883883387f, 0.0340783633f,
+    0.0131390048f, 0.00506577874f, 4.0f, 1.41421354f, 0.49999997f, 0.176776677f,
+    0.0624999925f, 0.0220970847f, 0.00781249907f, 0.00276213558f, 4.0f, 1.29683959f,
+    0.420448244f, 0.136313483f, 0.0441941805f, 0.0143281911f, 0.00464534154f, 0.00150606572f,
+    2.0f, 2.59367919f, 3.36358595f, 4.36203146f, 5.65685511f, 7.33603382f,
+    9.51365948f, 12.3376904f, 2.0f, 2.37841415f, 2.82842684f, 3.36358523f,
+    3.99999928f, 4.75682735f, 5.65685272f, 6.72716951f, 2.0f, 2.18101549f,
+    2.37841439f, 2.59367943f, 2.82842755f, 3.08442211f, 3.36358619f, 3.66801667f,
+    2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f,
+    2.0f, 2.0f, 2.0f, 1.8340081f, 1.68179286f, 1.54221082f,
+    1.41421354f, 1.29683959f, 1.1892072f, 1.09050786f, 2.0f, 1.68179286f,
+    1.41421366f, 1.1892072f, 1.00000012f, 0.840896547f, 0.707106888f, 0.594603658f,
+    2.0f, 1.54221082f, 1.18920708f, 0.917003989f, 0.707106709f, 0.545253813f,
+    0.420448154f, 0.324209839f, 2.0f, 1.41421354f, 0.99999994f, 0.707106709f,
+    0.49999994f, 0.353553355f, 0.24999997f, 0.176776677f, 2.0f, 1.29683959f,
+    0.840896487f, 0.545253932f, 0.353553444f, 0.229251057f, 0.148650929f, 0.0963882059f,
+    2.0f, 1.18920708f, 0.707106709f, 0.420448154f, 0.249999955f, 0.148650855f,
+    0.0883883238f, 0.0525560118f, 2.0f, 1.09050775f, 0.594603598f, 0.324209929f,
+    0.176776722f, 0.096388191f, 0.0525560342f, 0.0286563803f, 2.0f, 1.0f,
+    0.5f, 0.25f, 0.125f, 0.0625f, 0.03125f, 0.015625f,
+    2.0f, 0.917004049f, 0.420448214f, 0.192776352f, 0.0883883461f, 0.0405262373f,
+    0.0185813624f, 0.00851959269f, 2.0f, 0.840896428f, 0.353553414f, 0.1486509f,
+    0.0625000075f, 0.0262780171f, 0.0110485451f, 0.00464534108f, 2.0f, 0.771105409f,
+    0.297301769f, 0.114625499f, 0.0441941693f, 0.0170391817f, 0.00656950241f, 0.00253288937f,
+    2.0f, 0.707106769f, 0.249999985f, 0.0883883387f, 0.0312499963f, 0.0110485423f,
+    0.00390624953f, 0.00138106779f, 1.0f, 1.41421354f, 1.99999988f, 2.82842684f,
+    3.99999952f, 5.65685368f, 7.99999905f, 11.3137074f, 1.0f, 1.29683959f,
+    1.68179297f, 2.18101573f, 2.82842755f, 3.66801691f, 4.75682974f, 6.16884518f,
+    1.0f, 1.18920708f, 1.41421342f, 1.68179262f, 1.99999964f, 2.37841368f,
+    2.82842636f, 3.36358476f, 1.0f, 1.09050775f, 1.1892072f, 1.29683971f,
+    1.41421378f, 1.54221106f, 1.68179309f, 1.83400834f, 1.0f, 1.0f,
+    1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f,
+    1.0f, 0.917004049f, 0.840896428f, 0.771105409f, 0.707106769f, 0.648419797f,
+    0.594603598f, 0.545253932f, 1.0f, 0.840896428f, 0.707106829f, 0.594603598f,
+    0.50000006f, 0.420448273f, 0.353553444f, 0.297301829f, 1.0f, 0.771105409f,
+    0.594603539f, 0.458501995f, 0.353553355f, 0.272626907f, 0.210224077f, 0.16210492f,
+    1.0f, 0.707106769f, 0.49999997f, 0.353553355f, 0.24999997f, 0.176776677f,
+    0.124999985f, 0.0883883387f, 1.0f, 0.648419797f, 0.420448244f, 0.272626966f,
+    0.176776722f, 0.114625528f, 0.0743254647f, 0.0481941029f, 1.0f, 0.594603539f,
+    0.353553355f, 0.210224077f, 0.124999978f, 0.0743254274f, 0.0441941619f, 0.0262780059f,
+    1.0f, 0.545253873f, 0.297301799f, 0.162104964f, 0.088388361f, 0.0481940955f,
+    0.0262780171f, 0.0143281901f, 1.0f, 0.5f, 0.25f, 0.125f,
+    0.0625f, 0.03125f, 0.015625f, 0.0078125f, 1.0f, 0.458502024f,
+    0.210224107f, 0.0963881761f, 0.0441941731f, 0.0202631187f, 0.00929068122f, 0.00425979635f,
+    1.0f, 0.420448214f, 0.176776707f, 0.0743254498f, 0.0312500037f, 0.0131390085f,
+    0.00552427256f, 0.00232267054f, 1.0f, 0.385552704f, 0.148650885f, 0.0573127493f,
+    0.0220970847f, 0.00851959083f, 0.0032847512f, 0.00126644468f, 0.5f, 0.771105409f,
+    1.18920708f, 1.83400798f, 2.82842684f, 4.36203051f, 6.72717047f, 10.3747149f,
+    0.5f, 0.707106769f, 0.99999994f, 1.41421342f, 1.99999976f, 2.82842684f,
+    3.99999952f, 5.65685368f, 0.5f, 0.648419797f, 0.840896487f, 1.09050786f,
+    1.41421378f, 1.83400846f, 2.37841487f, 3.08442259f, 0.5f, 0.594603539f,
+    0.707106709f, 0.840896308f, 0.999999821f, 1.18920684f, 1.41421318f, 1.68179238f,
+    0.5f, 0.545253873f, 0.594603598f, 0.648419857f, 0.707106888f, 0.771105528f,
+    0.840896547f, 0.917004168f, 0.5f, 0.5f, 0.5f, 0.5f,
+    0.5f, 0.5f, 0.5f, 0.5f, 0.5f, 0.458502024f,
+    0.420448214f, 0.385552704f, 0.353553385f, 0.324209899f, 0.297301799f, 0.272626966f,
+    0.5f, 0.420448214f, 0.353553414f, 0.297301799f, 0.25000003f, 0.210224137f,
+    0.176776722f, 0.148650914f, 0.5f, 0.385552704f, 0.297301769f, 0.229250997f,
+    0.176776677f, 0.136313453f, 0.105112039f, 0.0810524598f, 0.5f, 0.353553385f,
+    0.249999985f, 0.176776677f, 0.124999985f, 0.0883883387f, 0.0624999925f, 0.0441941693f,
+    0.5f, 0.324209899f, 0.210224122f, 0.136313483f, 0.088388361f, 0.0573127642f,
+    0.0371627323f, 0.0240970515f, 0.5f, 0.297301769f, 0.176776677f, 0.105112039f,
+    0.0624999888f, 0.0371627137f, 0.0220970809f, 0.013139003f, 0.5f, 0.272626936f,
+    0.1486509f, 0.0810524821f, 0.0441941805f, 0.0240970477f, 0.0131390085f, 0.00716409506f,
+    0.5f, 0.25f, 0.125f, 0.0625f, 0.03125f, 0.015625f,
+    0.0078125f, 0.00390625f, 0.5f, 0.229251012f, 0.105112053f, 0.048194088f,
+    0.0220970865f, 0.0101315593f, 0.00464534061f, 0.00212989817f, 0.5f, 0.210224107f,
+    0.0883883536f, 0.0371627249f, 0.0156250019f, 0.00656950427f, 0.00276213628f, 0.00116133527f,
+    0.25f, 0.420448214f, 0.707106829f, 1.1892072f, 2.00000024f, 3.36358619f,
+    5.65685511f, 9.51365852f, 0.25f, 0.385552704f, 0.594603539f, 0.917003989f,
+    1.41421342f, 2.18101525f, 3.36358523f, 5.18735743f, 0.25f, 0.353553385f,
+    0.49999997f, 0.707106709f, 0.999999881f, 1.41421342f, 1.99999976f, 2.82842684f,
+    0.25f, 0.324209899f, 0.420448244f, 0.545253932f, 0.707106888f, 0.917004228f,
+    1.18920743f, 1.54221129f, 0.25f, 0.297301769f, 0.353553355f, 0.420448154f,
+    0.499999911f, 0.594603419f, 0.70710659f, 0.840896189f, 0.25f, 0.272626936f,
+    0.297301799f, 0.324209929f, 0.353553444f, 0.385552764f, 0.420448273f, 0.458502084f,
+    0.25f, 0.25f, 0.25f, 0.25f, 0.25f, 0.25f,
+    0.25f, 0.25f, 0.25f, 0.229251012f, 0.210224107f, 0.192776352f,
+    0.176776692f, 0.162104949f, 0.1486509f, 0.136313483f, 0.25f, 0.210224107f,
+    0.176776707f, 0.1486509f, 0.125000015f, 0.105112068f, 0.088388361f, 0.0743254572f,
+    0.25f, 0.192776352f, 0.148650885f, 0.114625499f, 0.0883883387f, 0.0681567267f,
+    0.0525560193f, 0.0405262299f, 0.25f, 0.176776692f, 0.124999993f, 0.0883883387f,
+    0.0624999925f, 0.0441941693f, 0.0312499963f, 0.0220970847f, 0.25f, 0.162104949f,
+    0.105112061f, 0.0681567416f, 0.0441941805f, 0.0286563821f, 0.0185813662f, 0.0120485257f,
+    0.25f, 0.148650885f, 0.0883883387f, 0.0525560193f, 0.0312499944f, 0.0185813569f,
+    0.0110485405f, 0.00656950148f, 0.25f, 0.136313468f, 0.0743254498f, 0.0405262411f,
+    0.0220970903f, 0.0120485239f, 0.00656950427f, 0.00358204753f, 0.25f, 0.125f,
+    0.0625f, 0.03125f, 0.015625f, 0.0078125f, 0.00390625f, 0.001953125f,
+    0.25f, 0.114625506f, 0.0525560267f, 0.024097044f, 0.0110485433f, 0.00506577967f,
+    0.00232267031f, 0.00106494909f, 0.125f, 0.229251012f, 0.420448214f, 0.771105409f,
+    1.41421354f, 2.59367919f, 4.75682878f, 8.72406292f, 0.125f, 0.210224107f,
+    0.353553414f, 0.594603598f, 1.00000012f, 1.68179309f, 2.82842755f, 4.75682926f,
+    0.125f, 0.192776352f, 0.297301769f, 0.458501995f, 0.707106709f, 1.09050763f,
+    1.68179262f, 2.59367871f, 0.125f, 0.176776692f, 0.249999985f, 0.353553355f,
+    0.49999994f, 0.707106709f, 0.999999881f, 1.41421342f, 0.125f, 0.162104949f,
+    0.210224122f, 0.272626966f, 0.353553444f, 0.458502114f, 0.594603717f, 0.771105647f,
+    0.125f, 0.148650885f, 0.176776677f, 0.210224077f, 0.249999955f, 0.29730171f,
+    0.353553295f, 0.420448095f, 0.125f, 0.136313468f, 0.1486509f, 0.162104964f,
+    0.176776722f, 0.192776382f, 0.210224137f, 0.229251042f, 0.125f, 0.125f,
+    0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f,
+    0.125f, 0.114625506f, 0.105112053f, 0.0963881761f, 0.0883883461f, 0.0810524747f,
+    0.0743254498f, 0.0681567416f, 0.125f, 0.105112053f, 0.0883883536f, 0.0743254498f,
+    0.0625000075f, 0.0525560342f, 0.0441941805f, 0.0371627286f, 0.125f, 0.0963881761f,
+    0.0743254423f, 0.0573127493f, 0.0441941693f, 0.0340783633f, 0.0262780096f, 0.0202631149f,
+    0.125f, 0.0883883461f, 0.0624999963f, 0.0441941693f, 0.0312499963f, 0.0220970847f,
+    0.0156249981f, 0.0110485423f, 0.125f, 0.0810524747f, 0.0525560305f, 0.0340783708f,
+    0.0220970903f, 0.0143281911f, 0.00929068308f, 0.00602426287f, 0.125f, 0.0743254423f,
+    0.0441941693f, 0.0262780096f, 0.0156249972f, 0.00929067843f, 0.00552427024f, 0.00328475074f,
+    0.125f, 0.0681567341f, 0.0371627249f, 0.0202631205f, 0.0110485451f, 0.00602426194f,
+    0.00328475214f, 0.00179102377f, 0.125f, 0.0625f, 0.03125f, 0.015625f,
+    0.0078125f, 0.00390625f, 0.001953125f, 0.0009765625f, 0.0625f, 0.125f,
+    0.25f, 0.5f, 1.0f, 2.0f, 4.0f, 8.0f,
+    0.0625f, 0.114625506f, 0.210224107f, 0.385552704f, 0.707106769f, 1.29683959f,
+    2.37841439f, 4.36203146f, 0.0625f, 0.105112053f, 0.176776707f, 0.297301799f,
+    0.50000006f, 0.840896547f, 1.41421378f, 2.37841463f, 0.0625f, 0.0963881761f,
+    0.148650885f, 0.229250997f, 0.353553355f, 0.545253813f, 0.840896308f, 1.29683936f,
+    0.0625f, 0.0883883461f, 0.124999993f, 0.176776677f, 0.24999997f, 0.353553355f,
+    0.49999994f, 0.707106709f, 0.0625f, 0.0810524747f, 0.105112061f, 0.136313483f,
+    0.176776722f, 0.229251057f, 0.297301859f, 0.385552824f, 0.0625f, 0.0743254423f,
+    0.0883883387f, 0.105112039f, 0.124999978f, 0.148650855f, 0.176776648f, 0.210224047f,
+    0.0625f, 0.0681567341f, 0.0743254498f, 0.0810524821f, 0.088388361f, 0.096388191f,
+    0.105112068f, 0.114625521f, 0.0625f, 0.0625f, 0.0625f, 0.0625f,
+    0.0625f, 0.0625f, 0.0625f, 0.0625f, 0.0625f, 0.0573127531f,
+    0.0525560267f, 0.048194088f, 0.0441941731f, 0.0405262373f, 0.0371627249f, 0.0340783708f,
+    0.0625f, 0.0525560267f, 0.0441941768f, 0.0371627249f, 0.0312500037f, 0.0262780171f,
+    0.0220970903f, 0.0185813643f, 0.0625f, 0.048194088f, 0.0371627212f, 0.0286563747f,
+    0.0220970847f, 0.0170391817f, 0.0131390048f, 0.0101315575f, 0.0625f, 0.0441941731f,
+    0.0312499981f, 0.0220970847f, 0.0156249981f, 0.0110485423f, 0.00781249907f, 0.00552427117f,
+    0.0625f, 0.0405262373f, 0.0262780152f, 0.0170391854f, 0.0110485451f, 0.00716409553f,
+    0.00464534154f, 0.00301213143f, 0.0625f, 0.0371627212f, 0.0220970847f, 0.0131390048f,
+    0.0078124986f, 0.00464533921f, 0.00276213512f, 0.00164237537f, 0.0625f, 0.0340783671f,
+    0.0185813624f, 0.0101315603f, 0.00552427256f, 0.00301213097f, 0.00164237607f, 0.000895511883f,
+    0.03125f, 0.0681567341f, 0.1486509f, 0.324209929f, 0.707106888f, 1.54221106f,
+    3.36358619f, 7.33603334f, 0.03125f, 0.0625f, 0.125f, 0.25f,
+    0.5f, 1.0f, 2.0f, 4.0f, 0.03125f, 0.0573127531f,
+    0.105112053f, 0.192776352f, 0.353553385f, 0.648419797f, 1.1892072f, 2.18101573f,
+    0.03125f, 0.0525560267f, 0.0883883536f, 0.1486509f, 0.25000003f, 0.420448273f,
+    0.707106888f, 1.18920732f, 0.03125f, 0.048194088f, 0.0743254423f, 0.114625499f,
+    0.176776677f, 0.272626907f, 0.420448154f, 0.648419678f, 0.03125f, 0.0441941731f,
+    0.0624999963f, 0.0883883387f, 0.124999985f, 0.176776677f, 0.24999997f, 0.353553355f,
+    0.03125f, 0.0405262373f, 0.0525560305f, 0.0681567416f, 0.088388361f, 0.114625528f,
+    0.148650929f, 0.192776412f, 0.03125f, 0.0371627212f, 0.0441941693f, 0.0525560193f,
+    0.0624999888f, 0.0743254274f, 0.0883883238f, 0.105112024f, 0.03125f, 0.0340783671f,
+    0.0371627249f, 0.0405262411f, 0.0441941805f, 0.0481940955f, 0.0525560342f, 0.0573127605f,
+    0.03125f, 0.03125f, 0.03125f, 0.03125f, 0.03125f, 0.03125f,
+    0.03125f, 0.03125f, 0.03125f, 0.0286563765f, 0.0262780134f, 0.024097044f,
+    0.0220970865f, 0.0202631187f, 0.0185813624f, 0.0170391854f, 0.03125f, 0.0262780134f,
+    0.0220970884f, 0.0185813624f, 0.0156250019f, 0.0131390085f, 0.0110485451f, 0.00929068215f,
+    0.03125f, 0.024097044f, 0.0185813606f, 0.0143281873f, 0.0110485423f, 0.00851959083f,
+    0.00656950241f, 0.00506577874f, 0.03125f, 0.0220970865f, 0.0156249991f, 0.0110485423f,
+    0.00781249907f, 0.00552427117f, 0.00390624953f, 0.00276213558f, 0.03125f, 0.0202631187f,
+    0.0131390076f, 0.00851959269f, 0.00552427256f, 0.00358204776f, 0.00232267077f, 0.00150606572f,
+    0.03125f, 0.0185813606f, 0.0110485423f, 0.00656950241f, 0.0039062493f, 0.00232266961f,
+    0.00138106756f, 0.000821187685f, 0.015625f, 0.0371627212f, 0.0883883387f, 0.210224077f,
+    0.499999911f, 1.18920684f, 2.82842636f, 6.72716951f, 0.015625f, 0.0340783671f,
+    0.0743254498f, 0.162104964f, 0.353553444f, 0.771105528f, 1.68179309f, 3.66801667f,
+    0.015625f, 0.03125f, 0.0625f, 0.125f, 0.25f, 0.5f,
+    1.0f, 2.0f, 0.015625f, 0.0286563765f, 0.0525560267f, 0.0963881761f,
+    0.176776692f, 0.324209899f, 0.594603598f, 1.09050786f, 0.015625f, 0.0262780134f,
+    0.0441941768f, 0.0743254498f, 0.125000015f, 0.210224137f, 0.353553444f, 0.594603658f,
+    0.015625f, 0.024097044f, 0.0371627212f, 0.0573127493f, 0.0883883387f, 0.136313453f,
+    0.210224077f, 0.324209839f, 0.015625f, 0.0220970865f, 0.0312499981f, 0.0441941693f,
+    0.0624999925f, 0.0883883387f, 0.124999985f, 0.176776677f, 0.015625f, 0.0202631187f,
+    0.0262780152f, 0.0340783708f, 0.0441941805f, 0.0573127642f, 0.0743254647f, 0.0963882059f,
+    0.015625f, 0.0185813606f, 0.0220970847f, 0.0262780096f, 0.0312499944f, 0.0371627137f,
+    0.0441941619f, 0.0525560118f, 0.015625f, 0.0170391835f, 0.0185813624f, 0.0202631205f,
+    0.0220970903f, 0.0240970477f, 0.0262780171f, 0.0286563803f, 0.015625f, 0.015625f,
+    0.015625f, 0.015625f, 0.015625f, 0.015625f, 0.015625f, 0.015625f,
+    0.015625f, 0.0143281883f, 0.0131390067f, 0.012048522f, 0.0110485433f, 0.0101315593f,
+    0.00929068122f, 0.00851959269f, 0.015625f, 0.0131390067f, 0.0110485442f, 0.00929068122f,
+    0.00781250093f, 0.00656950427f, 0.00552427256f, 0.00464534108f, 0.015625f, 0.012048522f,
+    0.00929068029f, 0.00716409367f, 0.00552427117f, 0.00425979542f, 0.0032847512f, 0.00253288937f,
+    0.015625f, 0.0110485433f, 0.00781249953f, 0.00552427117f, 0.00390624953f, 0.00276213558f,
+    0.00195312477f, 0.00138106779f, 0.015625f, 0.0101315593f, 0.00656950381f, 0.00425979635f,
+    0.00276213628f, 0.00179102388f, 0.00116133539f, 0.000753032858f, 0.0078125f, 0.0202631187f,
+    0.0525560305f, 0.136313483f, 0.353553444f, 0.917004228f, 2.37841487f, 6.16884518f,
+    0.0078125f, 0.0185813606f, 0.0441941693f, 0.105112039f, 0.249999955f, 0.594603419f,
+    1.41421318f, 3.36358476f, 0.0078125f, 0.0170391835f, 0.0371627249f, 0.0810524821f,
+    0.176776722f, 0.385552764f, 0.840896547f, 1.83400834f, 0.0078125f, 0.015625f,
+    0.03125f, 0.0625f, 0.125f, 0.25f, 0.5f, 1.0f,
+    0.0078125f, 0.0143281883f, 0.0262780134f, 0.048194088f, 0.0883883461f, 0.162104949f,
+    0.297301799f, 0.545253932f, 0.0078125f, 0.0131390067f, 0.0220970884f, 0.0371627249f,
+    0.0625000075f, 0.105112068f, 0.176776722f, 0.297301829f, 0.0078125f, 0.012048522f,
+    0.0185813606f, 0.0286563747f, 0.0441941693f, 0.0681567267f, 0.105112039f, 0.16210492f,
+    0.0078125f, 0.0110485433f, 0.0156249991f, 0.0220970847f, 0.0312499963f, 0.0441941693f,
+    0.0624999925f, 0.0883883387f, 0.0078125f, 0.0101315593f, 0.0131390076f, 0.0170391854f,
+    0.0220970903f, 0.0286563821f, 0.0371627323f, 0.0481941029f, 0.0078125f, 0.00929068029f,
+    0.0110485423f, 0.0131390048f, 0.0156249972f, 0.0185813569f, 0.0220970809f, 0.0262780059f,
+    0.0078125f, 0.00851959176f, 0.00929068122f, 0.0101315603f, 0.0110485451f, 0.0120485239f,
+    0.0131390085f, 0.0143281901f, 0.0078125f, 0.0078125f, 0.0078125f, 0.0078125f,
+    0.0078125f, 0.0078125f, 0.0078125f, 0.0078125f, 0.0078125f, 0.00716409413f,
+    0.00656950334f, 0.00602426101f, 0.00552427163f, 0.00506577967f, 0.00464534061f, 0.00425979635f,
+    0.0078125f, 0.00656950334f, 0.0055242721f, 0.00464534061f, 0.00390625047f, 0.00328475214f,
+    0.00276213628f, 0.00232267054f, 0.0078125f, 0.00602426101f, 0.00464534014f, 0.00358204683f,
+    0.00276213558f, 0.00212989771f, 0.0016423756f, 0.00126644468f, 0.0078125f, 0.00552427163f,
+    0.00390624977f, 0.00276213558f, 0.00195312477f, 0.00138106779f, 0.000976562384f, 0.000690533896f,
+    0.00390625f, 0.0110485433f, 0.0312499981f, 0.0883883387f, 0.24999997f, 0.707106709f,
+    1.99999976f, 5.65685368f, 0.00390625f, 0.0101315593f, 0.0262780152f, 0.0681567416f,
+    0.176776722f, 0.458502114f, 1.18920743f, 3.08442259f, 0.00390625f, 0.00929068029f,
+    0.0220970847f, 0.0525560193f, 0.124999978f, 0.29730171f, 0.70710659f, 1.68179238f,
+    0.00390625f, 0.00851959176f, 0.0185813624f, 0.0405262411f, 0.088388361f, 0.192776382f,
+    0.420448273f, 0.917004168f, 0.00390625f, 0.0078125f, 0.015625f, 0.03125f,
+    0.0625f, 0.125f, 0.25f, 0.5f, 0.00390625f, 0.00716409413f,
+    0.0131390067f, 0.024097044f, 0.0441941731f, 0.0810524747f, 0.1486509f, 0.272626966f,
+    0.00390625f, 0.00656950334f, 0.0110485442f, 0.0185813624f, 0.0312500037f, 0.0525560342f,
+    0.088388361f, 0.148650914f, 0.00390625f, 0.00602426101f, 0.00929068029f, 0.0143281873f,
+    0.0220970847f, 0.0340783633f, 0.0525560193f, 0.0810524598f, 0.00390625f, 0.00552427163f,
+    0.00781249953f, 0.0110485423f, 0.0156249981f, 0.0220970847f, 0.0312499963f, 0.0441941693f,
+    0.00390625f, 0.00506577967f, 0.00656950381f, 0.00851959269f, 0.0110485451f, 0.0143281911f,
+    0.0185813662f, 0.0240970515f, 0.00390625f, 0.00464534014f, 0.00552427117f, 0.00656950241f,
+    0.0078124986f, 0.00929067843f, 0.0110485405f, 0.013139003f, 0.00390625f, 0.00425979588f,
+    0.00464534061f, 0.00506578013f, 0.00552427256f, 0.00602426194f, 0.00656950427f, 0.00716409506f,
+    0.00390625f, 0.00390625f, 0.00390625f, 0.00390625f, 0.00390625f, 0.00390625f,
+    0.00390625f, 0.00390625f, 0.00390625f, 0.00358204707f, 0.00328475167f, 0.0030121305f,
+    0.00276213582f, 0.00253288983f, 0.00232267031f, 0.00212989817f, 0.00390625f, 0.00328475167f,
+    0.00276213605f, 0.00232267031f, 0.00195312523f, 0.00164237607f, 0.00138106814f, 0.00116133527f,
+    0.00390625f, 0.0030121305f, 0.00232267007f, 0.00179102342f, 0.00138106779f, 0.00106494885f,
+    0.000821187801f, 0.000633222342f, 0.001953125f, 0.00602426101f, 0.0185813606f, 0.0573127493f,
+    0.176776677f, 0.545253813f, 1.68179262f, 5.18735743f, 0.001953125f, 0.00552427163f,
+    0.0156249991f, 0.0441941693f, 0.124999985f, 0.353553355f, 0.999999881f, 2.82842684f,
+    0.001953125f, 0.00506577967f, 0.0131390076f, 0.0340783708f, 0.088388361f, 0.229251057f,
+    0.594603717f, 1.54221129f, 0.001953125f, 0.00464534014f, 0.0110485423f, 0.0262780096f,
+    0.0624999888f, 0.148650855f, 0.353553295f, 0.840896189f, 0.001953125f, 0.00425979588f,
+    0.00929068122f, 0.0202631205f, 0.0441941805f, 0.096388191f, 0.210224137f, 0.458502084f,
+    0.001953125f, 0.00390625f, 0.0078125f, 0.015625f, 0.03125f, 0.0625f,
+    0.125f, 0.25f, 0.001953125f, 0.00358204707f, 0.00656950334f, 0.012048522f,
+    0.0220970865f, 0.0405262373f, 0.0743254498f, 0.136313483f, 0.001953125f, 0.00328475167f,
+    0.0055242721f, 0.00929068122f, 0.0156250019f, 0.0262780171f, 0.0441941805f, 0.0743254572f,
+    0.001953125f, 0.0030121305f, 0.00464534014f, 0.00716409367f, 0.0110485423f, 0.0170391817f,
+    0.0262780096f, 0.0405262299f, 0.001953125f, 0.00276213582f, 0.00390624977f, 0.00552427117f,
+    0.00781249907f, 0.0110485423f, 0.0156249981f, 0.0220970847f, 0.001953125f, 0.00253288983f,
+    0.0032847519f, 0.00425979635f, 0.00552427256f, 0.00716409553f, 0.00929068308f, 0.0120485257f,
+    0.001953125f, 0.00232267007f, 0.00276213558f, 0.0032847512f, 0.0039062493f, 0.00464533921f,
+    0.00552427024f, 0.00656950148f, 0.001953125f, 0.00212989794f, 0.00232267031f, 0.00253289007f,
+    0.00276213628f, 0.00301213097f, 0.00328475214f, 0.00358204753f, 0.001953125f, 0.001953125f,
+    0.001953125f, 0.001953125f, 0.001953125f, 0.001953125f, 0.001953125f, 0.001953125f,
+    0.001953125f, 0.00179102353f, 0.00164237584f, 0.00150606525f, 0.00138106791f, 0.00126644492f,
+    0.00116133515f, 0.00106494909f, 0.001953125f, 0.00164237584f, 0.00138106802f, 0.00116133515f,
+    0.000976562616f, 0.000821188034f, 0.000690534071f, 0.000580667634f, 0.0009765625f, 0.00328475167f,
+    0.0110485442f, 0.0371627249f, 0.125000015f, 0.420448273f, 1.41421378f, 4.75682926f,
+    0.0009765625f, 0.0030121305f, 0.00929068029f, 0.0286563747f, 0.0883883387f, 0.272626907f,
+    0.840896308f, 2.59367871f, 0.0009765625f, 0.00276213582f, 0.00781249953f, 0.0220970847f,
+    0.0624999925f, 0.176776677f, 0.49999994f, 1.41421342f, 0.0009765625f, 0.00253288983f,
+    0.00656950381f, 0.0170391854f, 0.0441941805f, 0.114625528f, 0.297301859f, 0.771105647f,
+    0.0009765625f, 0.00232267007f, 0.00552427117f, 0.0131390048f, 0.0312499944f, 0.0743254274f,
+    0.176776648f, 0.420448095f, 0.0009765625f, 0.00212989794f, 0.00464534061f, 0.0101315603f,
+    0.0220970903f, 0.0481940955f, 0.105112068f, 0.229251042f, 0.0009765625f, 0.001953125f,
+    0.00390625f, 0.0078125f, 0.015625f, 0.03125f, 0.0625f, 0.125f,
+    0.0009765625f, 0.00179102353f, 0.00328475167f, 0.00602426101f, 0.0110485433f, 0.0202631187f,
+    0.0371627249f, 0.0681567416f, 0.0009765625f, 0.00164237584f, 0.00276213605f, 0.00464534061f,
+    0.00781250093f, 0.0131390085f, 0.0220970903f, 0.0371627286f, 0.0009765625f, 0.00150606525f,
+    0.00232267007f, 0.00358204683f, 0.00552427117f, 0.00851959083f, 0.0131390048f, 0.0202631149f,
+    0.0009765625f, 0.00138106791f, 0.00195312488f, 0.00276213558f, 0.00390624953f, 0.00552427117f,
+    0.00781249907f, 0.0110485423f, 0.0009765625f, 0.00126644492f, 0.00164237595f, 0.00212989817f,
+    0.00276213628f, 0.00358204776f, 0.00464534154f, 0.00602426287f, 0.0009765625f, 0.00116133504f,
+    0.00138106779f, 0.0016423756f, 0.00195312465f, 0.00232266961f, 0.00276213512f, 0.00328475074f,
+    0.0009765625f, 0.00106494897f, 0.00116133515f, 0.00126644503f, 0.00138106814f, 0.00150606548f,
+    0.00164237607f, 0.00179102377f, 0.0009765625f, 0.0009765625f, 0.0009765625f, 0.0009765625f,
+    0.0009765625f, 0.0009765625f, 0.0009765625f, 0.0009765625f, 0.0009765625f, 0.000895511766f,
+    0.000821187918f, 0.000753032626f, 0.000690533954f, 0.000633222458f, 0.000580667576f, 0.000532474543f,
+    0.00048828125f, 0.00179102353f, 0.00656950334f, 0.024097044f, 0.0883883461f, 0.324209899f,
+    1.1892072f, 4.36203146f, 0.00048828125f, 0.00164237584f, 0.0055242721f, 0.0185813624f,
+    0.0625000075f, 0.210224137f, 0.707106888f, 2.37841463f, 0.00048828125f, 0.00150606525f,
+    0.00464534014f, 0.0143281873f, 0.0441941693f, 0.136313453f, 0.420448154f, 1.29683936f,
+    0.00048828125f, 0.00138106791f, 0.00390624977f, 0.0110485423f, 0.0312499963f, 0.0883883387f,
+    0.24999997f, 0.707106709f, 0.00048828125f, 0.00126644492f, 0.0032847519f, 0.00851959269f,
+    0.0220970903f, 0.0573127642f, 0.148650929f, 0.385552824f, 0.00048828125f, 0.00116133504f,
+    0.00276213558f, 0.00656950241f, 0.0156249972f, 0.0371627137f, 0.0883883238f, 0.210224047f,
+    0.00048828125f, 0.00106494897f, 0.00232267031f, 0.00506578013f, 0.0110485451f, 0.0240970477f,
+    0.0525560342f, 0.114625521f, 0.00048828125f, 0.0009765625f, 0.001953125f, 0.00390625f,
+    0.0078125f, 0.015625f, 0.03125f, 0.0625f, 0.00048828125f, 0.000895511766f,
+    0.00164237584f, 0.0030121305f, 0.00552427163f, 0.0101315593f, 0.0185813624f, 0.0340783708f,
+    0.00048828125f, 0.000821187918f, 0.00138106802f, 0.00232267031f, 0.00390625047f, 0.00656950427f,
+    0.0110485451f, 0.0185813643f, 0.00048828125f, 0.000753032626f, 0.00116133504f, 0.00179102342f,
+    0.00276213558f, 0.00425979542f, 0.00656950241f, 0.0101315575f, 0.00048828125f, 0.000690533954f,
+    0.000976562442f, 0.00138106779f, 0.00195312477f, 0.00276213558f, 0.00390624953f, 0.00552427117f,
+    0.00048828125f, 0.000633222458f, 0.000821187976f, 0.00106494909f, 0.00138106814f, 0.00179102388f,
+    0.00232267077f, 0.00301213143f, 0.00048828125f, 0.000580667518f, 0.000690533896f, 0.000821187801f,
+    0.000976562325f, 0.0011613348f, 0.00138106756f, 0.00164237537f, 0.00048828125f, 0.000532474485f,
+    0.000580667576f, 0.000633222517f, 0.000690534071f, 0.000753032742f, 0.000821188034f, 0.000895511883f,
+    0.00048828125f, 0.00048828125f, 0.00048828125f, 0.00048828125f, 0.00048828125f, 0.00048828125f,
+    0.00048828125f, 0.00048828125f,
+  };
+
+  const HuffmanTable::LookupEntry
+      kHuffmanLookups[kNumHuffmanTables][1 << HuffmanTable::kMaxCodeBits] = {
+    { // Table 0
+      {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0},
+      {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0},
+      {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0},
+      {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0},
+      {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0},
+      {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0},
+      {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0},
+      {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0},
+      {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0},
+      {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0},
+      {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0},
+      {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0},
+      {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0},
+      {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0},
+      {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0},
+      {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0},
+      {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0},
+      {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0},
+      {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0},
+      {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0},
+      {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0},
+      {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0},
+      {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0},
+      {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0},
+      {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0},
+      {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0},
+      {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0},
+      {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0},
+      {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0},
+      {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0},
+      {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0},
+      {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0},
+    },
+    { // Table 1
+      {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1},
+      {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1},
+      {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1},
+      {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1},
+      {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1},
+      {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1},
+      {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1},
+      {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1},
+      {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1},
+      {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1},
+      {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1},
+      {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1},
+      {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1},
+      {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1},
+      {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1},
+      {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1},
+      {1,3}, {1,3}, {1,3}, {1,3}, {1,3}, {1,3}, {1,3}, {1,3},
+      {1,3}, {1,3}, {1,3}, {1,3}, {1,3}, {1,3}, {1,3}, {1,3},
+      {1,3}, {1,3}, {1,3}, {1,3}, {1,3}, {1,3}, {1,3}, {1,3},
+      {1,3}, {1,3}, {1,3}, {1,3}, {1,3}, {1,3}, {1,3}, {1,3},
+      {2,3}, {2,3}, {2,3}, {2,3}, {2,3}, {2,3}, {2,3}, {2,3},
+      {2,3}, {2,3}, {2,3}, {2,3}, {2,3}, {2,3}, {2,3}, {2,3},
+      {2,3}, {2,3}, {2,3}, {2,3}, {2,3}, {2,3}, {2,3}, {2,3},
+      {2,3}, {2,3}, {2,3}, {2,3}, {2,3}, {2,3}, {2,3}, {2,3},
+      {3,4}, {3,4}, {3,4}, {3,4}, {3,4}, {3,4}, {3,4}, {3,4},
+      {3,4}, {3,4}, {3,4}, {3,4}, {3,4}, {3,4}, {3,4}, {3,4},
+      {4,4}, {4,4}, {4,4}, {4,4}, {4,4}, {4,4}, {4,4}, {4,4},
+      {4,4}, {4,4}, {4,4}, {4,4}, {4,4}, {4,4}, {4,4}, {4,4},
+      {5,5}, {5,5}, {5,5}, {5,5}, {5,5}, {5,5}, {5,5}, {5,5},
+      {6,5}, {6,5}, {6,5}, {6,5}, {6,5}, {6,5}, {6,5}, {6,5},
+      {7,5}, {7,5}, {7,5}, {7,5}, {7,5}, {7,5}, {7,5}, {7,5},
+      {8,5}, {8,5}, {8,5}, {8,5}, {8,5}, {8,5}, {8,5}, {8,5},
+    },
+    { // Table 2
+      {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1},
+      {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1},
+      {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1},
+      {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1},
+      {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1},
+      {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1},
+      {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1},
+      {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1},
+      {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1},
+      {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1},
+      {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1},
+      {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1},
+      {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1},
+      {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1},
+      {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1},
+      {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1},
+      {1,3}, {1,3}, {1,3}, {1,3}, {1,3}, {1,3}, {1,3}, {1,3},
+      {1,3}, {1,3}, {1,3}, {1,3}, {1,3}, {1,3}, {1,3}, {1,3},
+      {1,3}, {1,3}, {1,3}, {1,3}, {1,3}, {1,3}, {1,3}, {1,3},
+      {1,3}, {1,3}, {1,3}, {1,3}, {1,3}, {1,3}, {1,3}, {1,3},
+      {-1,3}, {-1,3}, {-1,3}, {-1,3}, {-1,3}, {-1,3}, {-1,3}, {-1,3},
+      {-1,3}, {-1,3}, {-1,3}, {-1,3}, {-1,3}, {-1,3}, {-1,3}, {-1,3},
+      {-1,3}, {-1,3}, {-1,3}, {-1,3}, {-1,3}, {-1,3}, {-1,3}, {-1,3},
+      {-1,3}, {-1,3}, {-1,3}, {-1,3}, {-1,3}, {-1,3}, {-1,3}, {-1,3},
+      {2,3}, {2,3}, {2,3}, {2,3}, {2,3}, {2,3}, {2,3}, {2,3},
+      {2,3}, {2,3}, {2,3}, {2,3}, {2,3}, {2,3}, {2,3}, {2,3},
+      {2,3}, {2,3}, {2,3}, {2,3}, {2,3}, {2,3}, {2,3}, {2,3},
+      {2,3}, {2,3}, {2,3}, {2,3}, {2,3}, {2,3}, {2,3}, {2,3},
+      {-2,3}, {-2,3}, {-2,3}, {-2,3}, {-2,3}, {-2,3}, {-2,3}, {-2,3},
+      {-2,3}, {-2,3}, {-2,3}, {-2,3}, {-2,3}, {-2,3}, {-2,3}, {-2,3},
+      {-2,3}, {-2,3}, {-2,3}, {-2,3}, {-2,3}, {-2,3}, {-2,3}, {-2,3},
+      {-2,3}, {-2,3}, {-2,3}, {-2,3}, {-2,3}, {-2,3}, {-2,3}, {-2,3},
+    },
+    { // Table 3
+      {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1},
+      {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1},
+      {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1},
+      {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1},
+      {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1},
+      {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1},
+      {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1},
+      {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1},
+      {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1},
+      {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1},
+      {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1},
+      {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1},
+      {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1},
+      {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1},
+      {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1},
+      {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1},
+      {1,3}, {1,3}, {1,3}, {1,3}, {1,3}, {1,3}, {1,3}, {1,3},
+      {1,3}, {1,3}, {1,3}, {1,3}, {1,3}, {1,3}, {1,3}, {1,3},
+      {1,3}, {1,3}, {1,3}, {1,3}, {1,3}, {1,3}, {1,3}, {1,3},
+      {1,3}, {1,3}, {1,3}, {1,3}, {1,3}, {1,3}, {1,3}, {1,3},
+      {-1,3}, {-1,3}, {-1,3}, {-1,3}, {-1,3}, {-1,3}, {-1,3}, {-1,3},
+      {-1,3}, {-1,3}, {-1,3}, {-1,3}, {-1,3}, {-1,3}, {-1,3}, {-1,3},
+      {-1,3}, {-1,3}, {-1,3}, {-1,3}, {-1,3}, {-1,3}, {-1,3}, {-1,3},
+      {-1,3}, {-1,3}, {-1,3}, {-1,3}, {-1,3}, {-1,3}, {-1,3}, {-1,3},
+      {2,4}, {2,4}, {2,4}, {2,4}, {2,4}, {2,4}, {2,4}, {2,4},
+      {2,4}, {2,4}, {2,4}, {2,4}, {2,4}, {2,4}, {2,4}, {2,4},
+      {-2,4}, {-2,4}, {-2,4}, {-2,4}, {-2,4}, {-2,4}, {-2,4}, {-2,4},
+      {-2,4}, {-2,4}, {-2,4}, {-2,4}, {-2,4}, {-2,4}, {-2,4}, {-2,4},
+      {3,4}, {3,4}, {3,4}, {3,4}, {3,4}, {3,4}, {3,4}, {3,4},
+      {3,4}, {3,4}, {3,4}, {3,4}, {3,4}, {3,4}, {3,4}, {3,4},
+      {-3,4}, {-3,4}, {-3,4}, {-3,4}, {-3,4}, {-3,4}, {-3,4}, {-3,4},
+      {-3,4}, {-3,4}, {-3,4}, {-3,4}, {-3,4}, {-3,4}, {-3,4}, {-3,4},
+    },
+    { // Table 4
+      {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1},
+      {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1},
+      {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1},
+      {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1},
+      {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1},
+      {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1},
+      {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1},
+      {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1},
+      {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1},
+      {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1},
+      {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1},
+      {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1},
+      {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1},
+      {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1},
+      {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1},
+      {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1}, {0,1},
+      {1,3}, {1,3}, {1,3}, {1,3}, {1,3}, {1,3}, {1,3}, {1,3},
+      {1,3}, {1,3}, {1,3}, {1,3}, {1,3}, {1,3}, {1,3}, {1,3},
+      {1,3}, {1,3}, {1,3}, {1,3}, {1,3}, {1,3}, {1,3}, {1,3},
+      {1,3}, {1,3}, {1,3}, {1,3}, {1,3}, {1,3}, {1,3}, {1,3},
+      {-1,3}, {-1,3}, {-1,3}, {-1,3}, {-1,3}, {-1,3}, {-1,3}, {-1,3},
+      {-1,3}, {-1,3}, {-1,3}, {-1,3}, {-1,3}, {-1,3}, {-1,3}, {-1,3},
+      {-1,3}, {-1,3}, {-1,3}, {-1,3}, {-1,3}, {-1,3}, {-1,3}, {-1,3},
+      {-1,3}, {-1,3}, {-1,3}, {-1,3}, {-1,3}, {-1,3}, {-1,3}, {-1,3},
+      {2,4}, {2,4}, {2,4}, {2,4}, {2,4}, {2,4}, {2,4}, {2,4},
+      {2,4}, {2,4}, {2,4}, {2,4}, {2,4}, {2,4}, {2,4}, {2,4},
+      {-2,4}, {-2,4}, {-2,4}, {-2,4}, {-2,4}, {-2,4}, {-2,4}, {-2,4},
+      {-2,4}, {-2,4}, {-2,4}, {-2,4}, {-2,4}, {-2,4}, {-2,4}, {-2,4},
+      {3,5}, {3,5}, {3,5}, {3,5}, {3,5}, {3,5}, {3,5}, {3,5},
+      {-3,5}, {-3,5}, {-3,5}, {-3,5}, {-3,5}, {-3,5}, {-3,5}, {-3,5},
+      {4,5}, {4,5}, {4,5}, {4,5}, {4,5}, {4,5}, {4,5}, {4,5},
+      {-4,5}, {-4,5}, {-4,5}, {-4,5}, {-4,5}, {-4,5}, {-4,5}, {-4,5},
+    },
+    { // Table 5
+      {0,2}, {0,2}, {0,2}, {0,2}, {0,2}, {0,2}, {0,2}, {0,2},
+      {0,2}, {0,2}, {0,2}, {0,2}, {0,2}, {0,2}, {0,2}, {0,2},
+      {0,2}, {0,2}, {0,2}, {0,2}, {0,2}, {0,2}, {0,2}, {0,2},
+      {0,2}, {0,2}, {0,2}, {0,2}, {0,2}, {0,2}, {0,2}, {0,2},
+      {0,2}, {0,2}, {0,2}, {0,2}, {0,2}, {0,2}, {0,2}, {0,2},
+      {0,2}, {0,2}, {0,2}, {0,2}, {0,2}, {0,2}, {0,2}, {0,2},
+      {0,2}, {0,2}, {0,2}, {0,2}, {0,2}, {0,2}, {0,2}, {0,2},
+      {0,2}, {0,2}, {0,2}, {0,2}, {0,2}, {0,2}, {0,2}, {0,2},
+      {1,3}, {1,3}, {1,3}, {1,3}, {1,3}, {1,3}, {1,3}, {1,3},
+      {1,3}, {1,3}, {1,3}, {1,3}, {1,3}, {1,3}, {1,3}, {1,3},
+      {1,3}, {1,3}, {1,3}, {1,3}, {1,3}, {1,3}, {1,3}, {1,3},
+      {1,3}, {1,3}, {1,3}, {1,3}, {1,3}, {1,3}, {1,3}, {1,3},
+      {-1,3}, {-1,3}, {-1,3}, {-1,3}, {-1,3}, {-1,3}, {-1,3}, {-1,3},
+      {-1,3}, {-1,3}, {-1,3}, {-1,3}, {-1,3}, {-1,3}, {-1,3}, {-1,3},
+      {-1,3}, {-1,3}, {-1,3}, {-1,3}, {-1,3}, {-1,3}, {-1,3}, {-1,3},
+      {-1,3}, {-1,3}, {-1,3}, {-1,3}, {-1,3}, {-1,3}, {-1,3}, {-1,3},
+      {2,4}, {2,4}, {2,4}, {2,4}, {2,4}, {2,4}, {2,4}, {2,4},
+      {2,4}, {2,4}, {2,4}, {2,4}, {2,4}, {2,4}, {2,4}, {2,4},
+      {-2,4}, {-2,4}, {-2,4}, {-2,4}, {-2,4}, {-2,4}, {-2,4}, {-2,4},
+      {-2,4}, {-2,4}, {-2,4}, {-2,4}, {-2,4}, {-2,4}, {-2,4}, {-2,4},
+      {3,4}, {3,4}, {3,4}, {3,4}, {3,4}, {3,4}, {3,4}, {3,4},
+      {3,4}, {3,4}, {3,4}, {3,4}, {3,4}, {3,4}, {3,4}, {3,4},
+      {-3,4}, {-3,4}, {-3,4}, {-3,4}, {-3,4}, {-3,4}, {-3,4}, {-3,4},
+      {-3,4}, {-3,4}, {-3,4}, {-3,4}, {-3,4}, {-3,4}, {-3,4}, {-3,4},
+      {7,4}, {7,4}, {7,4}, {7,4}, {7,4}, {7,4}, {7,4}, {7,4},
+      {7,4}, {7,4}, {7,4}, {7,4}, {7,4}, {7,4}, {7,4}, {7,4},
+      {-7,4}, {-7,4}, {-7,4}, {-7,4}, {-7,4}, {-7,4}, {-7,4}, {-7,4},
+      {-7,4}, {-7,4}, {-7,4}, {-7,4}, {-7,4}, {-7,4}, {-7,4}, {-7,4},
+      {4,5}, {4,5}, {4,5}, {4,5}, {4,5}, {4,5}, {4,5}, {4,5},
+      {-4,5}, {-4,5}, {-4,5}, {-4,5}, {-4,5}, {-4,5}, {-4,5}, {-4,5},
+      {5,6}, {5,6}, {5,6}, {5,6}, {-5,6}, {-5,6}, {-5,6}, {-5,6},
+      {6,6}, {6,6}, {6,6}, {6,6}, {-6,6}, {-6,6}, {-6,6}, {-6,6},
+    },
+    { // Table 6
+      {0,3}, {0,3}, {0,3}, {0,3}, {0,3}, {0,3}, {0,3}, {0,3},
+      {0,3}, {0,3}, {0,3}, {0,3}, {0,3}, {0,3}, {0,3}, {0,3},
+      {0,3}, {0,3}, {0,3}, {0,3}, {0,3}, {0,3}, {0,3}, {0,3},
+      {0,3}, {0,3}, {0,3}, {0,3}, {0,3}, {0,3}, {0,3}, {0,3},
+      {1,4}, {1,4}, {1,4}, {1,4}, {1,4}, {1,4}, {1,4}, {1,4},
+      {1,4}, {1,4}, {1,4}, {1,4}, {1,4}, {1,4}, {1,4}, {1,4},
+      {-1,4}, {-1,4}, {-1,4}, {-1,4}, {-1,4}, {-1,4}, {-1,4}, {-1,4},
+      {-1,4}, {-1,4}, {-1,4}, {-1,4}, {-1,4}, {-1,4}, {-1,4}, {-1,4},
+      {2,4}, {2,4}, {2,4}, {2,4}, {2,4}, {2,4}, {2,4}, {2,4},
+      {2,4}, {2,4}, {2,4}, {2,4}, {2,4}, {2,4}, {2,4}, {2,4},
+      {-2,4}, {-2,4}, {-2,4}, {-2,4}, {-2,4}, {-2,4}, {-2,4}, {-2,4},
+      {-2,4}, {-2,4}, {-2,4}, {-2,4}, {-2,4}, {-2,4}, {-2,4}, {-2,4},
+      {3,4}, {3,4}, {3,4}, {3,4}, {3,4}, {3,4}, {3,4}, {3,4},
+      {3,4}, {3,4}, {3,4}, {3,4}, {3,4}, {3,4}, {3,4}, {3,4},
+      {-3,4}, {-3,4}, {-3,4}, {-3,4}, {-3,4}, {-3,4}, {-3,4}, {-3,4},
+      {-3,4}, {-3,4}, {-3,4}, {-3,4}, {-3,4}, {-3,4}, {-3,4}, {-3,4},
+      {15,4}, {15,4}, {15,4}, {15,4}, {15,4}, {15,4}, {15,4}, {15,4},
+      {15,4}, {15,4}, {15,4}, {15,4}, {15,4}, {15,4}, {15,4}, {15,4},
+      {-15,4}, {-15,4}, {-15,4}, {-15,4}, {-15,4}, {-15,4}, {-15,4}, {-15,4},
+      {-15,4}, {-15,4}, {-15,4}, {-15,4}, {-15,4}, {-15,4}, {-15,4}, {-15,4},
+      {4,5}, {4,5}, {4,5}, {4,5}, {4,5}, {4,5}, {4,5}, {4,5},
+      {-4,5}, {-4,5}, {-4,5}, {-4,5}, {-4,5}, {-4,5}, {-4,5}, {-4,5},
+      {5,5}, {5,5}, {5,5}, {5,5}, {5,5}, {5,5}, {5,5}, {5,5},
+      {-5,5}, {-5,5}, {-5,5}, {-5,5}, {-5,5}, {-5,5}, {-5,5}, {-5,5},
+      {6,5}, {6,5}, {6,5}, {6,5}, {6,5}, {6,5}, {6,5}, {6,5},
+      {-6,5}, {-6,5}, {-6,5}, {-6,5}, {-6,5}, {-6,5}, {-6,5}, {-6,5},
+      {7,6}, {7,6}, {7,6}, {7,6}, {-7,6}, {-7,6}, {-7,6}, {-7,6},
+      {8,6}, {8,6}, {8,6}, {8,6}, {-8,6}, {-8,6}, {-8,6}, {-8,6},
+      {9,6}, {9,6}, {9,6}, {9,6}, {-9,6}, {-9,6}, {-9,6}, {-9,6},
+      {10,6}, {10,6}, {10,6}, {10,6}, {-10,6}, {-10,6}, {-10,6}, {-10,6},
+      {11,7}, {11,7}, {-11,7}, {-11,7}, {12,7}, {12,7}, {-12,7}, {-12,7},
+      {13,7}, {13,7}, {-13,7}, {-13,7}, {14,7}, {14,7}, {-14,7}, {-14,7},
+    },
+    { // Table 7
+      {0,3}, {0,3}, {0,3}, {0,3}, {0,3}, {0,3}, {0,3}, {0,3},
+      {0,3}, {0,3}, {0,3}, {0,3}, {0,3}, {0,3}, {0,3}, {0,3},
+      {0,3}, {0,3}, {0,3}, {0,3}, {0,3}, {0,3}, {0,3}, {0,3},
+      {0,3}, {0,3}, {0,3}, {0,3}, {0,3}, {0,3}, {0,3}, {0,3},
+      {31,4}, {31,4}, {31,4}, {31,4}, {31,4}, {31,4}, {31,4}, {31,4},
+      {31,4}, {31,4}, {31,4}, {31,4}, {31,4}, {31,4}, {31,4}, {31,4},
+      {-31,4}, {-31,4}, {-31,4}, {-31,4}, {-31,4}, {-31,4}, {-31,4}, {-31,4},
+      {-31,4}, {-31,4}, {-31,4}, {-31,4}, {-31,4}, {-31,4}, {-31,4}, {-31,4},
+      {1,5}, {1,5}, {1,5}, {1,5}, {1,5}, {1,5}, {1,5}, {1,5},
+      {-1,5}, {-1,5}, {-1,5}, {-1,5}, {-1,5}, {-1,5}, {-1,5}, {-1,5},
+      {2,5}, {2,5}, {2,5}, {2,5}, {2,5}, {2,5}, {2,5}, {2,5},
+      {-2,5}, {-2,5}, {-2,5}, {-2,5}, {-2,5}, {-2,5}, {-2,5}, {-2,5},
+      {3,5}, {3,5}, {3,5}, {3,5}, {3,5}, {3,5}, {3,5}, {3,5},
+      {-3,5}, {-3,5}, {-3,5}, {-3,5}, {-3,5}, {-3,5}, {-3,5}, {-3,5},
+      {4,5}, {4,5}, {4,5}, {4,5}, {4,5}, {4,5}, {4,5}, {4,5},
+      {-4,5}, {-4,5}, {-4,5}, {-4,5}, {-4,5}, {-4,5}, {-4,5}, {-4,5},
+      {5,5}, {5,5}, {5,5}, {5,5}, {5,5}, {5,5}, {5,5}, {5,5},
+      {-5,5}, {-5,5}, {-5,5}, {-5,5}, {-5,5}, {-5,5}, {-5,5}, {-5,5},
+      {6,6}, {6,6}, {6,6}, {6,6}, {-6,6}, {-6,6}, {-6,6}, {-6,6},
+      {7,6}, {7,6}, {7,6}, {7,6}, {-7,6}, {-7,6}, {-7,6}, {-7,6},
+      {8,6}, {8,6}, {8,6}, {8,6}, {-8,6}, {-8,6}, {-8,6}, {-8,6},
+      {9,6}, {9,6}, {9,6}, {9,6}, {-9,6}, {-9,6}, {-9,6}, {-9,6},
+      {10,6}, {10,6}, {10,6}, {10,6}, {-10,6}, {-10,6}, {-10,6}, {-10,6},
+      {11,6}, {11,6}, {11,6}, {11,6}, {-11,6}, {-11,6}, {-11,6}, {-11,6},
+      {12,6}, {12,6}, {12,6}, {12,6}, {-12,6}, {-12,6}, {-12,6}, {-12,6},
+      {13,6}, {13,6}, {13,6}, {13,6}, {-13,6}, {-13,6}, {-13,6}, {-13,6},
+      {14,7}, {14,7}, {-14,7}, {-14,7}, {15,7}, {15,7}, {-15,7}, {-15,7},
+      {16,7}, {16,7}, {-16,7}, {-16,7}, {17,7}, {17,7}, {-17,7}, {-17,7},
+      {18,7}, {18,7}, {-18,7}, {-18,7}, {19,7}, {19,7}, {-19,7}, {-19,7},
+      {20,7}, {20,7}, {-20,7}, {-20,7}, {21,8}, {-21,8}, {22,8}, {-22,8},
+      {23,8}, {-23,8}, {24,8}, {-24,8}, {25,8}, {-25,8}, {26,8}, {-26,8},
+      {27,8}, {-27,8}, {28,8}, {-28,8}, {29,8}, {-29,8}, {30,8}, {-30,8},
+    },
+  };
+
+  const HuffmanTable::MultiSymbolEntry
+      kHuffmanMultiSymbolLookups[kNumMultiSymbolHuffmanTables][1 << HuffmanTable::kMultiSymbolBits] = {
+    { // Table 1
+      {{0,0,0,0},4,2}, {{0,0,0,0},4,2}, {{0,0,0,0},4,2}, {{0,0,0,0},4,2},
+      {{0,0,0,0},4,2}, {{0,0,0,0},4,2}, {{0,0,0,0},4,2}, {{0,0,0,0},4,2},
+      {{0,0,0,0},4,2}, {{0,0,0,0},4,2}, {{0,0,0,0},4,2}, {{0,0,0,0},4,2},
+      {{0,0,0,0},4,2}, {{0,0,0,0},4,2}, {{0,0,0,0},4,2}, {{0,0,0,0},4,2},
+      {{0,0,0,0},4,2}, {{0,0,0,0},4,2}, {{0,0,0,0},4,2}, {{0,0,0,0},4,2},
+      {{0,0,0,0},4,2}, {{0,0,0,0},4,2}, {{0,0,0,0},4,2}, {{0,0,0,0},4,2},
+      {{0,0,0,0},4,2}, {{0,0,0,0},4,2}, {{0,0,0,0},4,2}, {{0,0,0,0},4,2},
+      {{0,0,0,0},4,2}, {{0,0,0,0},4,2}, {{0,0,0,0},4,2}, {{0,0,0,0},4,2},
+      {{0,0,0,0},4,2}, {{0,0,0,0},4,2}, {{0,0,0,0},4,2}, {{0,0,0,0},4,2},
+      {{0,0,0,0},4,2}, {{0,0,0,0},4,2}, {{0,0,0,0},4,2}, {{0,0,0,0},4,2},
+      {{0,0,0,0},4,2}, {{0,0,0,0},4,2}, {{0,0,0,0},4,2}, {{0,0,0,0},4,2},
+      {{0,0,0,0},4,2}, {{0,0,0,0},4,2}, {{0,0,0,0},4,2}, {{0,0,0,0},4,2},
+      {{0,0,0,0},4,2}, {{0,0,0,0},4,2}, {{0,0,0,0},4,2}, {{0,0,0,0},4,2},
+      {{0,0,0,0},4,2}, {{0,0,0,0},4,2}, {{0,0,0,0},4,2}, {{0,0,0,0},4,2},
+      {{0,0,0,0},4,2}, {{0,0,0,0},4,2}, {{0,0,0,0},4,2}, {{0,0,0,0},4,2},
+      {{0,0,0,0},4,2}, {{0,0,0,0},4,2}, {{0,0,0,0},4,2}, {{0,0,0,0},4,2},
+      {{0,0,0,0},4,2}, {{0,0,0,0},4,2}, {{0,0,0,0},4,2}, {{0,0,0,0},4,2},
+      {{0,0,0,0},4,2}, {{0,0,0,0},4,2}, {{0,0,0,0},4,2}, {{0,0,0,0},4,2},
+      {{0,0,0,0},4,2}, {{0,0,0,0},4,2}, {{0,0,0,0},4,2}, {{0,0,0,0},4,2},
+      {{0,0,0,0},4,2}, {{0,0,0,0},4,2}, {{0,0,0,0},4,2}, {{0,0,0,0},4,2},
+      {{0,0,0,0},4,2}, {{0,0,0,0},4,2}, {{0,0,0,0},4,2}, {{0,0,0,0},4,2},
+      {{0,0,0,0},4,2}, {{0,0,0,0},4,2}, {{0,0,0,0},4,2}, {{0,0,0,0},4,2},
+      {{0,0,0,0},4,2}, {{0,0,0,0},4,2}, {{0,0,0,0},4,2}, {{0,0,0,0},4,2},
+      {{0,0,0,0},4,2}, {{0,0,0,0},4,2}, {{0,0,0,0},4,2}, {{0,0,0,0},4,2},
+      {{0,0,0,0},4,2}, {{0,0,0,0},4,2}, {{0,0,0,0},4,2}, {{0,0,0,0},4,2},
+      {{0,0,0,0},4,2}, {{0,0,0,0},4,2}, {{0,0,0,0},4,2}, {{0,0,0,0},4,2},
+      {{0,0,0,0},4,2}, {{0,0,0,0},4,2}, {{0,0,0,0},4,2}, {{0,0,0,0},4,2},
+      {{0,0,0,0},4,2}, {{0,0,0,0},4,2}, {{0,0,0,0},4,2}, {{0,0,0,0},4,2},
+      {{0,0,0,0},4,2}, {{0,0,0,0},4,2}, {{0,0,0,0},4,2}, {{0,0,0,0},4,2},
+      {{0,0,0,0},4,2}, {{0,0,0,0},4,2}, {{0,0,0,0},4,2}, {{0,0,0,0},4,2},
+      {{0,0,0,0},4,2}, {{0,0,0,0},4,2}, {{0,0,0,0},4,2}, {{0,0,0,0},4,2},
+      {{0,0,0,0},4,2}, {{0,0,0,0},4,2}, {{0,0,0,0},4,2}, {{0,0,0,0},4,2},
+      {{0,0,0,0},4,2}, {{0,0,0,0},4,2}, {{0,0,0,0},4,2}, {{0,0,0,0},4,2},
+      {{0,0,0,0},4,2}, {{0,0,0,0},4,2}, {{0,0,0,0},4,2}, {{0,0,0,0},4,2},
+      {{0,0,0,0},4,2}, {{0,0,0,0},4,2}, {{0,0,0,0},4,2}, {{0,0,0,0},4,2},
+      {{0,0,0,0},4,2}, {{0,0,0,0},4,2}, {{0,0,0,0},4,2}, {{0,0,0,0},4,2},
+      {{0,0,0,0},4,2}, {{0,0,0,0},4,2}, {{0,0,0,0},4,2}, {{0,0,0,0},4,2},
+      {{0,0,0,0},4,2}, {{0,0,0,0},4,2}, {{0,0,0,0},4,2}, {{0,0,0,0},4,2},
+      {{0,0,0,0},4,2}, {{0,0,0,0},4,2}, {{0,0,0,0},4,2}, {{0,0,0,0},4,2},
+      {{0,0,0,0},4,2}, {{0,0,0,0},4,2}, {{0,0,0,0},4,2}, {{0,0,0,0},4,2},
+      {{0,0,0,0},4,2}, {{0,0,0,0},4,2}, {{0,0,0,0},4,2}, {{0,0,0,0},4,2},
+      {{0,0,0,0},4,2}, {{0,0,0,0},4,2}, {{0,0,0,0},4,2}, {{0,0,0,0},4,2},
+      {{0,0,0,0},4,2}, {{0,0,0,0},4,2}, {{0,0,0,0},4,2}, {{0,0,0,0},4,2},
+      {{0,0,0,0},4,2}, {{0,0,0,0},4,2}, {{0,0,0,0},4,2}, {{0,0,0,0},4,2},
+      {{0,0,0,0},4,2}, {{0,0,0,0},4,2}, {{0,0,0,0},4,2}, {{0,0,0,0},4,2},
+      {{0,0,0,0},4,2}, {{0,0,0,0},4,2}, {{0,0,0,0},4,2}, {{0,0,0,0},4,2},
+      {{0,0,0,0},4,2}, {{0,0,0,0},4,2}, {{0,0,0,0},4,2}, {{0,0,0,0},4,2},
+      {{0,0,0,0},4,2}, {{0,0,0,0},4,2}, {{0,0,0,0},4,2}, {{0,0,0,0},4,2},
+      {{0,0,0,0},4,2}, {{0,0,0,0},4,2}, {{0,0,0,0},4,2}, {{0,0,0,0},4,2},
+      {{0,0,0,0},4,2}, {{0,0,0,0},4,2}, {{0,0,0,0},4,2}, {{0,0,0,0},4,2},
+      {{0,0,0,0},4,2}, {{0,0,0,0},4,2}, {{0,0,0,0},4,2}, {{0,0,0,0},4,2},
+      {{0,0,0,0},4,2}, {{0,0,0,0},4,2}, {{0,0,0,0},4,2}, {{0,0,0,0},4,2},
+      {{0,0,0,0},4,2}, {{0,0,0,0},4,2}, {{0,0,0,0},4,2}, {{0,0,0,0},4,2},
+      {{0,0,0,0},4,2}, {{0,0,0,0},4,2}, {{0,0,0,0},4,2}, {{0,0,0,0},4,2},
+      {{0,0,0,0},4,2}, {{0,0,0,0},4,2}, {{0,0,0,0},4,2}, {{0,0,0,0},4,2},
+      {{0,0,0,0},4,2}, {{0,0,0,0},4,2}, {{0,0,0,0},4,2}, {{0,0,0,0},4,2},
+      {{0,0,0,0},4,2}, {{0,0,0,0},4,2}, {{0,0,0,0},4,2}, {{0,0,0,0},4,2},
+      {{0,0,0,0},4,2}, {{0,0,0,0},4,2}, {{0,0,0,0},4,2}, {{0,0,0,0},4,2},
+      {{0,0,0,0},4,2}, {{0,0,0,0},4,2}, {{0,0,0,0},4,2}, {{0,0,0,0},4,2},
+      {{0,0,0,0},4,2}, {{0,0,0,0},4,2}, {{0,0,0,0},4,2}, {{0,0,0,0},4,2},
+      {{0,0,0,0},4,2}, {{0,0,0,0},4,2}, {{0,0,0,0},4,2}, {{0,0,0,0},4,2},
+      {{0,0,0,0},4,2}, {{0,0,0,0},4,2}, {{0,0,0,0},4,2}, {{0,0,0,0},4,2},
+      {{0,0,0,0},4,2}, {{0,0,0,0},4,2}, {{0,0,0,0},4,2}, {{0,0,0,0},4,2},
+      {{0,0,0,0},4,2}, {{0,0,0,0},4,2}, {{0,0,0,0},4,2}, {{0,0,0,0},4,2},
+      {{0,0,0,1},4,4}, {{0,0,0,1},4,4}, {{0,0,0,1},4,4}, {{0,0,0,1},4,4},
+      {{0,0,0,1},4,4}, {{0,0,0,1},4,4}, {{0,0,0,1},4,4}, {{0,0,0,1},4,4},
+      {{0,0,0,1},4,4}, {{0,0,0,1},4,4}, {{0,0,0,1},4,4}, {{0,0,0,1},4,4},
+      {{0,0,0,1},4,4}, {{0,0,0,1},4,4}, {{0,0,0,1},4,4}, {{0,0,0,1},4,4},
+      {{0,0,0,1},4,4}, {{0,0,0,1},4,4}, {{0,0,0,1},4,4}, {{0,0,0,1},4,4},
+      {{0,0,0,1},4,4}, {{0,0,0,1},4,4}, {{0,0,0,1},4,4}, {{0,0,0,1},4,4},
+      {{0,0,0,1},4,4}, {{0,0,0,1},4,4}, {{0,0,0,1},4,4}, {{0,0,0,1},4,4},
+      {{0,0,0,1},4,4}, {{0,0,0,1},4,4}, {{0,0,0,1},4,4}, {{0,0,0,1},4,4},
+      {{0,0,0,1},4,4}, {{0,0,0,1},4,4}, {{0,0,0,1},4,4}, {{0,0,0,1},4,4},
+      {{0,0,0,1},4,4}, {{0,0,0,1},4,4}, {{0,0,0,1},4,4}, {{0,0,0,1},4,4},
+      {{0,0,0,1},4,4}, {{0,0,0,1},4,4}, {{0,0,0,1},4,4}, {{0,0,0,1},4,4},
+      {{0,0,0,1},4,4}, {{0,0,0,1},4,4}, {{0,0,0,1},4,4}, {{0,0,0,1},4,4},
+      {{0,0,0,1},4,4}, {{0,0,0,1},4,4}, {{0,0,0,1},4,4}, {{0,0,0,1},4,4},
+      {{0,0,0,1},4,4}, {{0,0,0,1},4,4}, {{0,0,0,1},4,4}, {{0,0,0,1},4,4},
+      {{0,0,0,1},4,4}, {{0,0,0,1},4,4}, {{0,0,0,1},4,4}, {{0,0,0,1},4,4},
+      {{0,0,0,1},4,4}, {{0,0,0,1},4,4}, {{0,0,0,1},4,4}, {{0,0,0,1},4,4},
+      {{0,0,0,-1},4,4}, {{0,0,0,-1},4,4}, {{0,0,0,-1},4,4}, {{0,0,0,-1},4,4},
+      {{0,0,0,-1},4,4}, {{0,0,0,-1},4,4}, {{0,0,0,-1},4,4}, {{0,0,0,-1},4,4},
+      {{0,0,0,-1},4,4}, {{0,0,0,-1},4,4}, {{0,0,0,-1},4,4}, {{0,0,0,-1},4,4},
+      {{0,0,0,-1},4,4}, {{0,0,0,-1},4,4}, {{0,0,0,-1},4,4}, {{0,0,0,-1},4,4},
+      {{0,0,0,-1},4,4}, {{0,0,0,-1},4,4}, {{0,0,0,-1},4,4}, {{0,0,0,-1},4,4},
+      {{0,0,0,-1},4,4}, {{0,0,0,-1},4,4}, {{0,0,0,-1},4,4}, {{0,0,0,-1},4,4},
+      {{0,0,0,-1},4,4}, {{0,0,0,-1},4,4}, {{0,0,0,-1},4,4}, {{0,0,0,-1},4,4},
+      {{0,0,0,-1},4,4}, {{0,0,0,-1},4,4}, {{0,0,0,-1},4,4}, {{0,0,0,-1},4,4},
+      {{0,0,0,-1},4,4}, {{0,0,0,-1},4,4}, {{0,0,0,-1},4,4}, {{0,0,0,-1},4,4},
+      {{0,0,0,-1},4,4}, {{0,0,0,-1},4,4}, {{0,0,0,-1},4,4}, {{0,0,0,-1},4,4},
+      {{0,0,0,-1},4,4}, {{0,0,0,-1},4,4}, {{0,0,0,-1},4,4}, {{0,0,0,-1},4,4},
+      {{0,0,0,-1},4,4}, {{0,0,0,-1},4,4}, {{0,0,0,-1},4,4}, {{0,0,0,-1},4,4},
+      {{0,0,0,-1},4,4}, {{0,0,0,-1},4,4}, {{0,0,0,-1},4,4}, {{0,0,0,-1},4,4},
+      {{0,0,0,-1},4,4}, {{0,0,0,-1},4,4}, {{0,0,0,-1},4,4}, {{0,0,0,-1},4,4},
+      {{0,0,0,-1},4,4}, {{0,0,0,-1},4,4}, {{0,0,0,-1},4,4}, {{0,0,0,-1},4,4},
+      {{0,0,0,-1},4,4}, {{0,0,0,-1},4,4}, {{0,0,0,-1},4,4}, {{0,0,0,-1},4,4},
+      {{0,0,1,0},4,5}, {{0,0,1,0},4,5}, {{0,0,1,0},4,5}, {{0,0,1,0},4,5},
+      {{0,0,1,0},4,5}, {{0,0,1,0},4,5}, {{0,0,1,0},4,5}, {{0,0,1,0},4,5},
+      {{0,0,1,0},4,5}, {{0,0,1,0},4,5}, {{0,0,1,0},4,5}, {{0,0,1,0},4,5},
+      {{0,0,1,0},4,5}, {{0,0,1,0},4,5}, {{0,0,1,0},4,5}, {{0,0,1,0},4,5},
+      {{0,0,1,0},4,5}, {{0,0,1,0},4,5}, {{0,0,1,0},4,5}, {{0,0,1,0},4,5},
+      {{0,0,1,0},4,5}, {{0,0,1,0},4,5}, {{0,0,1,0},4,5}, {{0,0,1,0},4,5},
+      {{0,0,1,0},4,5}, {{0,0,1,0},4,5}, {{0,0,1,0},4,5}, {{0,0,1,0},4,5},
+      {{0,0,1,0},4,5}, {{0,0,1,0},4,5}, {{0,0,1,0},4,5}, {{0,0,1,0},4,5},
+      {{0,0,-1,0},4,5}, {{0,0,-1,0},4,5}, {{0,0,-1,0},4,5}, {{0,0,-1,0},4,5},
+      {{0,0,-1,0},4,5}, {{0,0,-1,0},4,5}, {{0,0,-1,0},4,5}, {{0,0,-1,0},4,5},
+      {{0,0,-1,0},4,5}, {{0,0,-1,0},4,5}, {{0,0,-1,0},4,5}, {{0,0,-1,0},4,5},
+      {{0,0,-1,0},4,5}, {{0,0,-1,0},4,5}, {{0,0,-1,0},4,5}, {{0,0,-1,0},4,5},
+      {{0,0,-1,0},4,5}, {{0,0,-1,0},4,5}, {{0,0,-1,0},4,5}, {{0,0,-1,0},4,5},
+      {{0,0,-1,0},4,5}, {{0,0,-1,0},4,5}, {{0,0,-1,0},4,5}, {{0,0,-1,0},4,5},
+      {{0,0,-1,0},4,5}, {{0,0,-1,0},4,5}, {{0,0,-1,0},4,5}, {{0,0,-1,0},4,5},
+      {{0,0,-1,0},4,5}, {{0,0,-1,0},4,5}, {{0,0,-1,0},4,5}, {{0,0,-1,0},4,5},
+      {{0,0,1,1},4,6}, {{0,0,1,1},4,6}, {{0,0,1,1},4,6}, {{0,0,1,1},4,6},
+      {{0,0,1,1},4,6}, {{0,0,1,1},4,6}, {{0,0,1,1},4,6}, {{0,0,1,1},4,6},
+      {{0,0,1,1},4,6}, {{0,0,1,1},4,6}, {{0,0,1,1},4,6}, {{0,0,1,1},4,6},
+      {{0,0,1,1},4,6}, {{0,0,1,1},4,6}, {{0,0,1,1},4,6}, {{0,0,1,1},4,6},
+      {{0,0,1,-1},4,6}, {{0,0,1,-1},4,6}, {{0,0,1,-1},4,6}, {{0,0,1,-1},4,6},
+      {{0,0,1,-1},4,6}, {{0,0,1,-1},4,6}, {{0,0,1,-1},4,6}, {{0,0,1,-1},4,6},
+      {{0,0,1,-1},4,6}, {{0,0,1,-1},4,6}, {{0,0,1,-1},4,6}, {{0,0,1,-1},4,6},
+      {{0,0,1,-1},4,6}, {{0,0,1,-1},4,6}, {{0,0,1,-1},4,6}, {{0,0,1,-1},4,6},
+      {{0,0,-1,1},4,6}, {{0,0,-1,1},4,6}, {{0,0,-1,1},4,6}, {{0,0,-1,1},4,6},
+      {{0,0,-1,1},4,6}, {{0,0,-1,1},4,6}, {{0,0,-1,1},4,6}, {{0,0,-1,1},4,6},
+      {{0,0,-1,1},4,6}, {{0,0,-1,1},4,6}, {{0,0,-1,1},4,6}, {{0,0,-1,1},4,6},
+      {{0,0,-1,1},4,6}, {{0,0,-1,1},4,6}, {{0,0,-1,1},4,6}, {{0,0,-1,1},4,6},
+      {{0,0,-1,-1},4,6}, {{0,0,-1,-1},4,6}, {{0,0,-1,-1},4,6}, {{0,0,-1,-1},4,6},
+      {{0,0,-1,-1},4,6}, {{0,0,-1,-1},4,6}, {{0,0,-1,-1},4,6}, {{0,0,-1,-1},4,6},
+      {{0,0,-1,-1},4,6}, {{0,0,-1,-1},4,6}, {{0,0,-1,-1},4,6}, {{0,0,-1,-1},4,6},
+      {{0,0,-1,-1},4,6}, {{0,0,-1,-1},4,6}, {{0,0,-1,-1},4,6}, {{0,0,-1,-1},4,6},
+      {{0,1,0,0},4,4}, {{0,1,0,0},4,4}, {{0,1,0,0},4,4}, {{0,1,0,0},4,4},
+      {{0,1,0,0},4,4}, {{0,1,0,0},4,4}, {{0,1,0,0},4,4}, {{0,1,0,0},4,4},
+      {{0,1,0,0},4,4}, {{0,1,0,0},4,4}, {{0,1,0,0},4,4}, {{0,1,0,0},4,4},
+      {{0,1,0,0},4,4}, {{0,1,0,0},4,4}, {{0,1,0,0},4,4}, {{0,1,0,0},4,4},
+      {{0,1,0,0},4,4}, {{0,1,0,0},4,4}, {{0,1,0,0},4,4}, {{0,1,0,0},4,4},
+      {{0,1,0,0},4,4}, {{0,1,0,0},4,4}, {{0,1,0,0},4,4}, {{0,1,0,0},4,4},
+      {{0,1,0,0},4,4}, {{0,1,0,0},4,4}, {{0,1,0,0},4,4}, {{0,1,0,0},4,4},
+      {{0,1,0,0},4,4}, {{0,1,0,0},4,4}, {{0,1,0,0},4,4}, {{0,1,0,0},4,4},
+      {{0,1,0,0},4,4}, {{0,1,0,0},4,4}, {{0,1,0,0},4,4}, {{0,1,0,0},4,4},
+      {{0,1,0,0},4,4}, {{0,1,0,0},4,4}, {{0,1,0,0},4,4}, {{0,1,0,0},4,4},
+      {{0,1,0,0},4,4}, {{0,1,0,0},4,4}, {{0,1,0,0},4,4}, {{0,1,0,0},4,4},
+      {{0,1,0,0},4,4}, {{0,1,0,0},4,4}, {{0,1,0,0},4,4}, {{0,1,0,0},4,4},
+      {{0,1,0,0},4,4}, {{0,1,0,0},4,4}, {{0,1,0,0},4,4}, {{0,1,0,0},4,4},
+      {{0,1,0,0},4,4}, {{0,1,0,0},4,4}, {{0,1,0,0},4,4}, {{0,1,0,0},4,4},
+      {{0,1,0,0},4,4}, {{0,1,0,0},4,4}, {{0,1,0,0},4,4}, {{0,1,0,0},4,4},
+      {{0,1,0,0},4,4}, {{0,1,0,0},4,4}, {{0,1,0,0},4,4}, {{0,1,0,0},4,4},
+      {{0,1,0,1},4,6}, {{0,1,0,1},4,6}, {{0,1,0,1},4,6}, {{0,1,0,1},4,6},
+      {{0,1,0,1},4,6}, {{0,1,0,1},4,6}, {{0,1,0,1},4,6}, {{0,1,0,1},4,6},
+      {{0,1,0,1},4,6}, {{0,1,0,1},4,6}, {{0,1,0,1},4,6}, {{0,1,0,1},4,6},
+      {{0,1,0,1},4,6}, {{0,1,0,1},4,6}, {{0,1,0,1},4,6}, {{0,1,0,1},4,6},
+      {{0,1,0,-1},4,6}, {{0,1,0,-1},4,6}, {{0,1,0,-1},4,6}, {{0,1,0,-1},4,6},
+      {{0,1,0,-1},4,6}, {{0,1,0,-1},4,6}, {{0,1,0,-1},4,6}, {{0,1,0,-1},4,6},
+      {{0,1,0,-1},4,6}, {{0,1,0,-1},4,6}, {{0,1,0,-1},4,6}, {{0,1,0,-1},4,6},
+      {{0,1,0,-1},4,6}, {{0,1,0,-1},4,6}, {{0,1,0,-1},4,6}, {{0,1,0,-1},4,6},
+      {{0,1,1,0},4,7}, {{0,1,1,0},4,7}, {{0,1,1,0},4,7}, {{0,1,1,0},4,7},
+      {{0,1,1,0},4,7}, {{0,1,1,0},4,7}, {{0,1,1,0},4,7}, {{0,1,1,0},4,7},
+      {{0,1,-1,0},4,7}, {{0,1,-1,0},4,7}, {{0,1,-1,0},4,7}, {{0,1,-1,0},4,7},
+      {{0,1,-1,0},4,7}, {{0,1,-1,0},4,7}, {{0,1,-1,0},4,7}, {{0,1,-1,0},4,7},
+      {{0,1,1,1},4,8}, {{0,1,1,1},4,8}, {{0,1,1,1},4,8}, {{0,1,1,1},4,8},
+      {{0,1,1,-1},4,8}, {{0,1,1,-1},4,8}, {{0,1,1,-1},4,8}, {{0,1,1,-1},4,8},
+      {{0,1,-1,1},4,8}, {{0,1,-1,1},4,8}, {{0,1,-1,1},4,8}, {{0,1,-1,1},4,8},
+      {{0,1,-1,-1},4,8}, {{0,1,-1,-1},4,8}, {{0,1,-1,-1},4,8}, {{0,1,-1,-1},4,8},
+      {{0,-1,0,0},4,4}, {{0,-1,0,0},4,4}, {{0,-1,0,0},4,4}, {{0,-1,0,0},4,4},
+      {{0,-1,0,0},4,4}, {{0,-1,0,0},4,4}, {{0,-1,0,0},4,4}, {{0,-1,0,0},4,4},
+      {{0,-1,0,0},4,4}, {{0,-1,0,0},4,4}, {{0,-1,0,0},4,4}, {{0,-1,0,0},4,4},
+      {{0,-1,0,0},4,4}, {{0,-1,0,0},4,4}, {{0,-1,0,0},4,4}, {{0,-1,0,0},4,4},
+      {{0,-1,0,0},4,4}, {{0,-1,0,0},4,4}, {{0,-1,0,0},4,4}, {{0,-1,0,0},4,4},
+      {{0,-1,0,0},4,4}, {{0,-1,0,0},4,4}, {{0,-1,0,0},4,4}, {{0,-1,0,0},4,4},
+      {{0,-1,0,0},4,4}, {{0,-1,0,0},4,4}, {{0,-1,0,0},4,4}, {{0,-1,0,0},4,4},
+      {{0,-1,0,0},4,4}, {{0,-1,0,0},4,4}, {{0,-1,0,0},4,4}, {{0,-1,0,0},4,4},
+      {{0,-1,0,0},4,4}, {{0,-1,0,0},4,4}, {{0,-1,0,0},4,4}, {{0,-1,0,0},4,4},
+      {{0,-1,0,0},4,4}, {{0,-1,0,0},4,4}, {{0,-1,0,0},4,4}, {{0,-1,0,0},4,4},
+      {{0,-1,0,0},4,4}, {{0,-1,0,0},4,4}, {{0,-1,0,0},4,4}, {{0,-1,0,0},4,4},
+      {{0,-1,0,0},4,4}, {{0,-1,0,0},4,4}, {{0,-1,0,0},4,4}, {{0,-1,0,0},4,4},
+      {{0,-1,0,0},4,4}, {{0,-1,0,0},4,4}, {{0,-1,0,0},4,4}, {{0,-1,0,0},4,4},
+      {{0,-1,0,0},4,4}, {{0,-1,0,0},4,4}, {{0,-1,0,0},4,4}, {{0,-1,0,0},4,4},
+      {{0,-1,0,0},4,4}, {{0,-1,0,0},4,4}, {{0,-1,0,0},4,4}, {{0,-1,0,0},4,4},
+      {{0,-1,0,0},4,4}, {{0,-1,0,0},4,4}, {{0,-1,0,0},4,4}, {{0,-1,0,0},4,4},
+      {{0,-1,0,1},4,6}, {{0,-1,0,1},4,6}, {{0,-1,0,1},4,6}, {{0,-1,0,1},4,6},
+      {{0,-1,0,1},4,6}, {{0,-1,0,1},4,6}, {{0,-1,0,1},4,6}, {{0,-1,0,1},4,6},
+      {{0,-1,0,1},4,6}, {{0,-1,0,1},4,6}, {{0,-1,0,1},4,6}, {{0,-1,0,1},4,6},
+      {{0,-1,0,1},4,6}, {{0,-1,0,1},4,6}, {{0,-1,0,1},4,6}, {{0,-1,0,1},4,6},
+      {{0,-1,0,-1},4,6}, {{0,-1,0,-1},4,6}, {{0,-1,0,-1},4,6}, {{0,-1,0,-1},4,6},
+      {{0,-1,0,-1},4,6}, {{0,-1,0,-1},4,6}, {{0,-1,0,-1},4,6}, {{0,-1,0,-1},4,6},
+      {{0,-1,0,-1},4,6}, {{0,-1,0,-1},4,6}, {{0,-1,0,-1},4,6}, {{0,-1,0,-1},4,6},
+      {{0,-1,0,-1},4,6}, {{0,-1,0,-1},4,6}, {{0,-1,0,-1},4,6}, {{0,-1,0,-1},4,6},
+      {{0,-1,1,0},4,7}, {{0,-1,1,0},4,7}, {{0,-1,1,0},4,7}, {{0,-1,1,0},4,7},
+      {{0,-1,1,0},4,7}, {{0,-1,1,0},4,7}, {{0,-1,1,0},4,7}, {{0,-1,1,0},4,7},
+      {{0,-1,-1,0},4,7}, {{0,-1,-1,0},4,7}, {{0,-1,-1,0},4,7}, {{0,-1,-1,0},4,7},
+      {{0,-1,-1,0},4,7}, {{0,-1,-1,0},4,7}, {{0,-1,-1,0},4,7}, {{0,-1,-1,0},4,7},
+      {{0,-1,1,1},4,8}, {{0,-1,1,1},4,8}, {{0,-1,1,1},4,8}, {{0,-1,1,1},4,8},
+      {{0,-1,1,-1},4,8}, {{0,-1,1,-1},4,8}, {{0,-1,1,-1},4,8}, {{0,-1,1,-1},4,8},
+      {{0,-1,-1,1},4,8}, {{0,-1,-1,1},4,8}, {{0,-1,-1,1},4,8}, {{0,-1,-1,1},4,8},
+      {{0,-1,-1,-1},4,8}, {{0,-1,-1,-1},4,8}, {{0,-1,-1,-1},4,8}, {{0,-1,-1,-1},4,8},
+      {{1,0,0,0},4,5}, {{1,0,0,0},4,5}, {{1,0,0,0},4,5}, {{1,0,0,0},4,5},
+      {{1,0,0,0},4,5}, {{1,0,0,0},4,5}, {{1,0,0,0},4,5}, {{1,0,0,0},4,5},
+      {{1,0,0,0},4,5}, {{1,0,0,0},4,5}, {{1,0,0,0},4,5}, {{1,0,0,0},4,5},
+      {{1,0,0,0},4,5}, {{1,0,0,0},4,5}, {{1,0,0,0},4,5}, {{1,0,0,0},4,5},
+      {{1,0,0,0},4,5}, {{1,0,0,0},4,5}, {{1,0,0,0},4,5}, {{1,0,0,0},4,5},
+      {{1,0,0,0},4,5}, {{1,0,0,0},4,5}, {{1,0,0,0},4,5}, {{1,0,0,0},4,5},
+      {{1,0,0,0},4,5}, {{1,0,0,0},4,5}, {{1,0,0,0},4,5}, {{1,0,0,0},4,5},
+      {{1,0,0,0},4,5}, {{1,0,0,0},4,5}, {{1,0,0,0},4,5}, {{1,0,0,0},4,5},
+      {{1,0,0,1},4,7}, {{1,0,0,1},4,7}, {{1,0,0,1},4,7}, {{1,0,0,1},4,7},
+      {{1,0,0,1},4,7}, {{1,0,0,1},4,7}, {{1,0,0,1},4,7}, {{1,0,0,1},4,7},
+      {{1,0,0,-1},4,7}, {{1,0,0,-1},4,7}, {{1,0,0,-1},4,7}, {{1,0,0,-1},4,7},
+      {{1,0,0,-1},4,7}, {{1,0,0,-1},4,7}, {{1,0,0,-1},4,7}, {{1,0,0,-1},4,7},
+      {{1,0,1,0},4,8}, {{1,0,1,0},4,8}, {{1,0,1,0},4,8}, {{1,0,1,0},4,8},
+      {{1,0,-1,0},4,8}, {{1,0,-1,0},4,8}, {{1,0,-1,0},4,8}, {{1,0,-1,0},4,8},
+      {{1,0,1,1},4,9}, {{1,0,1,1},4,9}, {{1,0,1,-1},4,9}, {{1,0,1,-1},4,9},
+      {{1,0,-1,1},4,9}, {{1,0,-1,1},4,9}, {{1,0,-1,-1},4,9}, {{1,0,-1,-1},4,9},
+      {{-1,0,0,0},4,5}, {{-1,0,0,0},4,5}, {{-1,0,0,0},4,5}, {{-1,0,0,0},4,5},
+      {{-1,0,0,0},4,5}, {{-1,0,0,0},4,5}, {{-1,0,0,0},4,5}, {{-1,0,0,0},4,5},
+      {{-1,0,0,0},4,5}, {{-1,0,0,0},4,5}, {{-1,0,0,0},4,5}, {{-1,0,0,0},4,5},
+      {{-1,0,0,0},4,5}, {{-1,0,0,0},4,5}, {{-1,0,0,0},4,5}, {{-1,0,0,0},4,5},
+      {{-1,0,0,0},4,5}, {{-1,0,0,0},4,5}, {{-1,0,0,0},4,5}, {{-1,0,0,0},4,5},
+      {{-1,0,0,0},4,5}, {{-1,0,0,0},4,5}, {{-1,0,0,0},4,5}, {{-1,0,0,0},4,5},
+      {{-1,0,0,0},4,5}, {{-1,0,0,0},4,5}, {{-1,0,0,0},4,5}, {{-1,0,0,0},4,5},
+      {{-1,0,0,0},4,5}, {{-1,0,0,0},4,5}, {{-1,0,0,0},4,5}, {{-1,0,0,0},4,5},
+      {{-1,0,0,1},4,7}, {{-1,0,0,1},4,7}, {{-1,0,0,1},4,7}, {{-1,0,0,1},4,7},
+      {{-1,0,0,1},4,7}, {{-1,0,0,1},4,7}, {{-1,0,0,1},4,7}, {{-1,0,0,1},4,7},
+      {{-1,0,0,-1},4,7}, {{-1,0,0,-1},4,7}, {{-1,0,0,-1},4,7}, {{-1,0,0,-1},4,7},
+      {{-1,0,0,-1},4,7}, {{-1,0,0,-1},4,7}, {{-1,0,0,-1},4,7}, {{-1,0,0,-1},4,7},
+      {{-1,0,1,0},4,8}, {{-1,0,1,0},4,8}, {{-1,0,1,0},4,8}, {{-1,0,1,0},4,8},
+      {{-1,0,-1,0},4,8}, {{-1,0,-1,0},4,8}, {{-1,0,-1,0},4,8}, {{-1,0,-1,0},4,8},
+      {{-1,0,1,1},4,9}, {{-1,0,1,1},4,9}, {{-1,0,1,-1},4,9}, {{-1,0,1,-1},4,9},
+      {{-1,0,-1,1},4,9}, {{-1,0,-1,1},4,9}, {{-1,0,-1,-1},4,9}, {{-1,0,-1,-1},4,9},
+      {{1,1,0,0},4,6}, {{1,1,0,0},4,6}, {{1,1,0,0},4,6}, {{1,1,0,0},4,6},
+      {{1,1,0,0},4,6}, {{1,1,0,0},4,6}, {{1,1,0,0},4,6}, {{1,1,0,0},4,6},
+      {{1,1,0,0},4,6}, {{1,1,0,0},4,6}, {{1,1,0,0},4,6}, {{1,1,0,0},4,6},
+      {{1,1,0,0},4,6}, {{1,1,0,0},4,6}, {{1,1,0,0},4,6}, {{1,1,0,0},4,6},
+      {{1,1,0,1},4,8}, {{1,1,0,1},4,8}, {{1,1,0,1},4,8}, {{1,1,0,1},4,8},
+      {{1,1,0,-1},4,8}, {{1,1,0,-1},4,8}, {{1,1,0,-1},4,8}, {{1,1,0,-1},4,8},
+      {{1,1,1,0},4,9}, {{1,1,1,0},4,9}, {{1,1,-1,0},4,9}, {{1,1,-1,0},4,9},
+      {{1,1,1,1},4,10}, {{1,1,1,-1},4,10}, {{1,1,-1,1},4,10}, {{1,1,-1,-1},4,10},
+      {{1,-1,0,0},4,6}, {{1,-1,0,0},4,6}, {{1,-1,0,0},4,6}, {{1,-1,0,0},4,6},
+      {{1,-1,0,0},4,6}, {{1,-1,0,0},4,6}, {{1,-1,0,0},4,6}, {{1,-1,0,0},4,6},
+      {{1,-1,0,0},4,6}, {{1,-1,0,0},4,6}, {{1,-1,0,0},4,6}, {{1,-1,0,0},4,6},
+      {{1,-1,0,0},4,6}, {{1,-1,0,0},4,6}, {{1,-1,0,0},4,6}, {{1,-1,0,0},4,6},
+      {{1,-1,0,1},4,8}, {{1,-1,0,1},4,8}, {{1,-1,0,1},4,8}, {{1,-1,0,1},4,8},
+      {{1,-1,0,-1},4,8}, {{1,-1,0,-1},4,8}, {{1,-1,0,-1},4,8}, {{1,-1,0,-1},4,8},
+      {{1,-1,1,0},4,9}, {{1,-1,1,0},4,9}, {{1,-1,-1,0},4,9}, {{1,-1,-1,0},4,9},
+      {{1,-1,1,1},4,10}, {{1,-1,1,-1},4,10}, {{1,-1,-1,1},4,10}, {{1,-1,-1,-1},4,10},
+      {{-1,1,0,0},4,6}, {{-1,1,0,0},4,6}, {{-1,1,0,0},4,6}, {{-1,1,0,0},4,6},
+      {{-1,1,0,0},4,6}, {{-1,1,0,0},4,6}, {{-1,1,0,0},4,6}, {{-1,1,0,0},4,6},
+      {{-1,1,0,0},4,6}, {{-1,1,0,0},4,6}, {{-1,1,0,0},4,6}, {{-1,1,0,0},4,6},
+      {{-1,1,0,0},4,6}, {{-1,1,0,0},4,6}, {{-1,1,0,0},4,6}, {{-1,1,0,0},4,6},
+      {{-1,1,0,1},4,8}, {{-1,1,0,1},4,8}, {{-1,1,0,1},4,8}, {{-1,1,0,1},4,8},
+      {{-1,1,0,-1},4,8}, {{-1,1,0,-1},4,8}, {{-1,1,0,-1},4,8}, {{-1,1,0,-1},4,8},
+      {{-1,1,1,0},4,9}, {{-1,1,1,0},4,9}, {{-1,1,-1,0},4,9}, {{-1,1,-1,0},4,9},
+      {{-1,1,1,1},4,10}, {{-1,1,1,-1},4,10}, {{-1,1,-1,1},4,10}, {{-1,1,-1,-1},4,10},
+      {{-1,-1,0,0},4,6}, {{-1,-1,0,0},4,6}, {{-1,-1,0,0},4,6}, {{-1,-1,0,0},4,6},
+      {{-1,-1,0,0},4,6}, {{-1,-1,0,0},4,6}, {{-1,-1,0,0},4,6}, {{-1,-1,0,0},4,6},
+      {{-1,-1,0,0},4,6}, {{-1,-1,0,0},4,6}, {{-1,-1,0,0},4,6}, {{-1,-1,0,0},4,6},
+      {{-1,-1,0,0},4,6}, {{-1,-1,0,0},4,6}, {{-1,-1,0,0},4,6}, {{-1,-1,0,0},4,6},
+      {{-1,-1,0,1},4,8}, {{-1,-1,0,1},4,8}, {{-1,-1,0,1},4,8}, {{-1,-1,0,1},4,8},
+      {{-1,-1,0,-1},4,8}, {{-1,-1,0,-1},4,8}, {{-1,-1,0,-1},4,8}, {{-1,-1,0,-1},4,8},
+      {{-1,-1,1,0},4,9}, {{-1,-1,1,0},4,9}, {{-1,-1,-1,0},4,9}, {{-1,-1,-1,0},4,9},
+      {{-1,-1,1,1},4,10}, {{-1,-1,1,-1},4,10}, {{-1,-1,-1,1},4,10}, {{-1,-1,-1,-1},4,10},
+    },
+    { // Table 2
+      {{0,0,0,0},4,4}, {{0,0,0,0},4,4}, {{0,0,0,0},4,4}, {{0,0,0,0},4,4},
+      {{0,0,0,0},4,4}, {{0,0,0,0},4,4}, {{0,0,0,0},4,4}, {{0,0,0,0},4,4},
+      {{0,0,0,0},4,4}, {{0,0,0,0},4,4}, {{0,0,0,0},4,4}, {{0,0,0,0},4,4},
+      {{0,0,0,0},4,4}, {{0,0,0,0},4,4}, {{0,0,0,0},4,4}, {{0,0,0,0},4,4},
+      {{0,0,0,0},4,4}, {{0,0,0,0},4,4}, {{0,0,0,0},4,4}, {{0,0,0,0},4,4},
+      {{0,0,0,0},4,4}, {{0,0,0,0},4,4}, {{0,0,0,0},4,4}, {{0,0,0,0},4,4},
+      {{0,0,0,0},4,4}, {{0,0,0,0},4,4}, {{0,0,0,0},4,4}, {{0,0,0,0},4,4},
+      {{0,0,0,0},4,4}, {{0,0,0,0},4,4}, {{0,0,0,0},4,4}, {{0,0,0,0},4,4},
+      {{0,0,0,0},4,4}, {{0,0,0,0},4,4}, {{0,0,0,0},4,4}, {{0,0,0,0},4,4},
+      {{0,0,0,0},4,4}, {{0,0,0,0},4,4}, {{0,0,0,0},4,4}, {{0,0,0,0},4,4},
+      {{0,0,0,0},4,4}, {{0,0,0,0},4,4}, {{0,0,0,0},4,4}, {{0,0,0,0},4,4},
+      {{0,0,0,0},4,4}, {{0,0,0,0},4,4}, {{0,0,0,0},4,4}, {{0,0,0,0},4,4},
+      {{0,0,0,0},4,4}, {{0,0,0,0},4,4}, {{0,0,0,0},4,4}, {{0,0,0,0},4,4},
+      {{0,0,0,0},4,4}, {{0,0,0,0},4,4}, {{0,0,0,0},4,4}, {{0,0,0,0},4,4},
+      {{0,0,0,0},4,4}, {{0,0,0,0},4,4}, {{0,0,0,0},4,4}, {{0,0,0,0},4,4},
+      {{0,0,0,0},4,4}, {{0,0,0,0},4,4}, {{0,0,0,0},4,4}, {{0,0,0,0},4,4},
+      {{0,0,0,1},4,6}, {{0,0,0,1},4,6}, {{0,0,0,1},4,6}, {{0,0,0,1},4,6},
+      {{0,0,0,1},4,6}, {{0,0,0,1},4,6}, {{0,0,0,1},4,6}, {{0,0,0,1},4,6},
+      {{0,0,0,1},4,6}, {{0,0,0,1},4,6}, {{0,0,0,1},4,6}, {{0,0,0,1},4,6},
+      {{0,0,0,1},4,6}, {{0,0,0,1},4,6}, {{0,0,0,1},4,6}, {{0,0,0,1},4,6},
+      {{0,0,0,-1},4,6}, {{0,0,0,-1},4,6}, {{0,0,0,-1},4,6}, {{0,0,0,-1},4,6},
+      {{0,0,0,-1},4,6}, {{0,0,0,-1},4,6}, {{0,0,0,-1},4,6}, {{0,0,0,-1},4,6},
+      {{0,0,0,-1},4,6}, {{0,0,0,-1},4,6}, {{0,0,0,-1},4,6}, {{0,0,0,-1},4,6},
+      {{0,0,0,-1},4,6}, {{0,0,0,-1},4,6}, {{0,0,0,-1},4,6}, {{0,0,0,-1},4,6},
+      {{0,0,0,2},4,6}, {{0,0,0,2},4,6}, {{0,0,0,2},4,6}, {{0,0,0,2},4,6},
+      {{0,0,0,2},4,6}, {{0,0,0,2},4,6}, {{0,0,0,2},4,6}, {{0,0,0,2},4,6},
+      {{0,0,0,2},4,6}, {{0,0,0,2},4,6}, {{0,0,0,2},4,6}, {{0,0,0,2},4,6},
+      {{0,0,0,2},4,6}, {{0,0,0,2},4,6}, {{0,0,0,2},4,6}, {{0,0,0,2},4,6},
+      {{0,0,0,-2},4,6}, {{0,0,0,-2},4,6}, {{0,0,0,-2},4,6}, {{0,0,0,-2},4,6},
+      {{0,0,0,-2},4,6}, {{0,0,0,-2},4,6}, {{0,0,0,-2},4,6}, {{0,0,0,-2},4,6},
+      {{0,0,0,-2},4,6}, {{0,0,0,-2},4,6}, {{0,0,0,-2},4,6}, {{0,0,0,-2},4,6},
+      {{0,0,0,-2},4,6}, {{0,0,0,-2},4,6}, {{0,0,0,-2},4,6}, {{0,0,0,-2},4,6},
+      {{0,0,1,0},4,6}, {{0,0,1,0},4,6}, {{0,0,1,0},4,6}, {{0,0,1,0},4,6},
+      {{0,0,1,0},4,6}, {{0,0,1,0},4,6}, {{0,0,1,0},4,6}, {{0,0,1,0},4,6},
+      {{0,0,1,0},4,6}, {{0,0,1,0},4,6}, {{0,0,1,0},4,6}, {{0,0,1,0},4,6},
+      {{0,0,1,0},4,6}, {{0,0,1,0},4,6}, {{0,0,1,0},4,6}, {{0,0,1,0},4,6},
+      {{0,0,1,1},4,8}, {{0,0,1,1},4,8}, {{0,0,1,1},4,8}, {{0,0,1,1},4,8},
+      {{0,0,1,-1},4,8}, {{0,0,1,-1},4,8}, {{0,0,1,-1},4,8}, {{0,0,1,-1},4,8},
+      {{0,0,1,2},4,8}, {{0,0,1,2},4,8}, {{0,0,1,2},4,8}, {{0,0,1,2},4,8},
+      {{0,0,1,-2},4,8}, {{0,0,1,-2},4,8}, {{0,0,1,-2},4,8}, {{0,0,1,-2},4,8},
+      {{0,0,-1,0},4,6}, {{0,0,-1,0},4,6}, {{0,0,-1,0},4,6}, {{0,0,-1,0},4,6},
+      {{0,0,-1,0},4,6}, {{0,0,-1,0},4,6}, {{0,0,-1,0},4,6}, {{0,0,-1,0},4,6},
+      {{0,0,-1,0},4,6}, {{0,0,-1,0},4,6}, {{0,0,-1,0},4,6}, {{0,0,-1,0},4,6},
+      {{0,0,-1,0},4,6}, {{0,0,-1,0},4,6}, {{0,0,-1,0},4,6}, {{0,0,-1,0},4,6},
+      {{0,0,-1,1},4,8}, {{0,0,-1,1},4,8}, {{0,0,-1,1},4,8}, {{0,0,-1,1},4,8},
+      {{0,0,-1,-1},4,8}, {{0,0,-1,-1},4,8}, {{0,0,-1,-1},4,8}, {{0,0,-1,-1},4,8},
+      {{0,0,-1,2},4,8}, {{0,0,-1,2},4,8}, {{0,0,-1,2},4,8}, {{0,0,-1,2},4,8},
+      {{0,0,-1,-2},4,8}, {{0,0,-1,-2},4,8}, {{0,0,-1,-2},4,8}, {{0,0,-1,-2},4,8},
+      {{0,0,2,0},4,6}, {{0,0,2,0},4,6}, {{0,0,2,0},4,6}, {{0,0,2,0},4,6},
+      {{0,0,2,0},4,6}, {{0,0,2,0},4,6}, {{0,0,2,0},4,6}, {{0,0,2,0},4,6},
+      {{0,0,2,0},4,6}, {{0,0,2,0},4,6}, {{0,0,2,0},4,6}, {{0,0,2,0},4,6},
+      {{0,0,2,0},4,6}, {{0,0,2,0},4,6}, {{0,0,2,0},4,6}, {{0,0,2,0},4,6},
+      {{0,0,2,1},4,8}, {{0,0,2,1},4,8}, {{0,0,2,1},4,8}, {{0,0,2,1},4,8},
+      {{0,0,2,-1},4,8}, {{0,0,2,-1},4,8}, {{0,0,2,-1},4,8}, {{0,0,2,-1},4,8},
+      {{0,0,2,2},4,8}, {{0,0,2,2},4,8}, {{0,0,2,2},4,8}, {{0,0,2,2},4,8},
+      {{0,0,2,-2},4,8}, {{0,0,2,-2},4,8}, {{0,0,2,-2},4,8}, {{0,0,2,-2},4,8},
+      {{0,0,-2,0},4,6}, {{0,0,-2,0},4,6}, {{0,0,-2,0},4,6}, {{0,0,-2,0},4,6},
+      {{0,0,-2,0},4,6}, {{0,0,-2,0},4,6}, {{0,0,-2,0},4,6}, {{0,0,-2,0},4,6},
+      {{0,0,-2,0},4,6}, {{0,0,-2,0},4,6}, {{0,0,-2,0},4,6}, {{0,0,-2,0},4,6},
+      {{0,0,-2,0},4,6}, {{0,0,-2,0},4,6}, {{0,0,-2,0},4,6}, {{0,0,-2,0},4,6},
+      {{0,0,-2,1},4,8}, {{0,0,-2,1},4,8}, {{0,0,-2,1},4,8}, {{0,0,-2,1},4,8},
+      {{0,0,-2,-1},4,8}, {{0,0,-2,-1},4,8}, {{0,0,-2,-1},4,8}, {{0,0,-2,-1},4,8},
+      {{0,0,-2,2},4,8}, {{0,0,-2,2},4,8}, {{0,0,-2,2},4,8}, {{0,0,-2,2},4,8},
+      {{0,0,-2,-2},4,8}, {{0,0,-2,-2},4,8}, {{0,0,-2,-2},4,8}, {{0,0,-2,-2},4,8},
+      {{0,1,0,0},4,6}, {{0,1,0,0},4,6}, {{0,1,0,0},4,6}, {{0,1,0,0},4,6},
+      {{0,1,0,0},4,6}, {{0,1,0,0},4,6}, {{0,1,0,0},4,6}, {{0,1,0,0},4,6},
+      {{0,1,0,0},4,6}, {{0,1,0,0},4,6}, {{0,1,0,0},4,6}, {{0,1,0,0},4,6},
+      {{0,1,0,0},4,6}, {{0,1,0,0},4,6}, {{0,1,0,0},4,6}, {{0,1,0,0},4,6},
+      {{0,1,0,1},4,8}, {{0,1,0,1},4,8}, {{0,1,0,1},4,8}, {{0,1,0,1},4,8},
+      {{0,1,0,-1},4,8}, {{0,1,0,-1},4,8}, {{0,1,0,-1},4,8}, {{0,1,0,-1},4,8},
+      {{0,1,0,2},4,8}, {{0,1,0,2},4,8}, {{0,1,0,2},4,8}, {{0,1,0,2},4,8},
+      {{0,1,0,-2},4,8}, {{0,1,0,-2},4,8}, {{0,1,0,-2},4,8}, {{0,1,0,-2},4,8},
+      {{0,1,1,0},4,8}, {{0,1,1,0},4,8}, {{0,1,1,0},4,8}, {{0,1,1,0},4,8},
+      {{0,1,1,1},4,10}, {{0,1,1,-1},4,10}, {{0,1,1,2},4,10}, {{0,1,1,-2},4,10},
+      {{0,1,-1,0},4,8}, {{0,1,-1,0},4,8}, {{0,1,-1,0},4,8}, {{0,1,-1,0},4,8},
+      {{0,1,-1,1},4,10}, {{0,1,-1,-1},4,10}, {{0,1,-1,2},4,10}, {{0,1,-1,-2},4,10},
+      {{0,1,2,0},4,8}, {{0,1,2,0},4,8}, {{0,1,2,0},4,8}, {{0,1,2,0},4,8},
+      {{0,1,2,1},4,10}, {{0,1,2,-1},4,10}, {{0,1,2,2},4,10}, {{0,1,2,-2},4,10},
+      {{0,1,-2,0},4,8}, {{0,1,-2,0},4,8}, {{0,1,-2,0},4,8}, {{0,1,-2,0},4,8},
+      {{0,1,-2,1},4,10}, {{0,1,-2,-1},4,10}, {{0,1,-2,2},4,10}, {{0,1,-2,-2},4,10},
+      {{0,-1,0,0},4,6}, {{0,-1,0,0},4,6}, {{0,-1,0,0},4,6}, {{0,-1,0,0},4,6},
+      {{0,-1,0,0},4,6}, {{0,-1,0,0},4,6}, {{0,-1,0,0},4,6}, {{0,-1,0,0},4,6},
+      {{0,-1,0,0},4,6}, {{0,-1,0,0},4,6}, {{0,-1,0,0},4,6}, {{0,-1,0,0},4,6},
+      {{0,-1,0,0},4,6}, {{0,-1,0,0},4,6}, {{0,-1,0,0},4,6}, {{0,-1,0,0},4,6},
+      {{0,-1,0,1},4,8}, {{0,-1,0,1},4,8}, {{0,-1,0,1},4,8}, {{0,-1,0,1},4,8},
+      {{0,-1,0,-1},4,8}, {{0,-1,0,-1},4,8}, {{0,-1,0,-1},4,8}, {{0,-1,0,-1},4,8},
+      {{0,-1,0,2},4,8}, {{0,-1,0,2},4,8}, {{0,-1,0,2},4,8}, {{0,-1,0,2},4,8},
+      {{0,-1,0,-2},4,8}, {{0,-1,0,-2},4,8}, {{0,-1,0,-2},4,8}, {{0,-1,0,-2},4,8},
+      {{0,-1,1,0},4,8}, {{0,-1,1,0},4,8}, {{0,-1,1,0},4,8}, {{0,-1,1,0},4,8},
+      {{0,-1,1,1},4,10}, {{0,-1,1,-1},4,10}, {{0,-1,1,2},4,10}, {{0,-1,1,-2},4,10},
+      {{0,-1,-1,0},4,8}, {{0,-1,-1,0},4,8}, {{0,-1,-1,0},4,8}, {{0,-1,-1,0},4,8},
+      {{0,-1,-1,1},4,10}, {{0,-1,-1,-1},4,10}, {{0,-1,-1,2},4,10}, {{0,-1,-1,-2},4,10},
+      {{0,-1,2,0},4,8}, {{0,-1,2,0},4,8}, {{0,-1,2,0},4,8}, {{0,-1,2,0},4,8},
+      {{0,-1,2,1},4,10}, {{0,-1,2,-1},4,10}, {{0,-1,2,2},4,10}, {{0,-1,2,-2},4,10},
+      {{0,-1,-2,0},4,8}, {{0,-1,-2,0},4,8}, {{0,-1,-2,0},4,8}, {{0,-1,-2,0},4,8},
+      {{0,-1,-2,1},4,10}, {{0,-1,-2,-1},4,10}, {{0,-1,-2,2},4,10}, {{0,-1,-2,-2},4,10},
+      {{0,2,0,0},4,6}, {{0,2,0,0},4,6}, {{0,2,0,0},4,6}, {{0,2,0,0},4,6},
+      {{0,2,0,0},4,6}, {{0,2,0,0},4,6}, {{0,2,0,0},4,6}, {{0,2,0,0},4,6},
+      {{0,2,0,0},4,6}, {{0,2,0,0},4,6}, {{0,2,0,0},4,6}, {{0,2,0,0},4,6},
+      {{0,2,0,0},4,6}, {{0,2,0,0},4,6}, {{0,2,0,0},4,6}, {{0,2,0,0},4,6},
+      {{0,2,0,1},4,8}, {{0,2,0,1},4,8}, {{0,2,0,1},4,8}, {{0,2,0,1},4,8},
+      {{0,2,0,-1},4,8}, {{0,2,0,-1},4,8}, {{0,2,0,-1},4,8}, {{0,2,0,-1},4,8},
+      {{0,2,0,2},4,8}, {{0,2,0,2},4,8}, {{0,2,0,2},4,8}, {{0,2,0,2},4,8},
+      {{0,2,0,-2},4,8}, {{0,2,0,-2},4,8}, {{0,2,0,-2},4,8}, {{0,2,0,-2},4,8},
+      {{0,2,1,0},4,8}, {{0,2,1,0},4,8}, {{0,2,1,0},4,8}, {{0,2,1,0},4,8},
+      {{0,2,1,1},4,10}, {{0,2,1,-1},4,10}, {{0,2,1,2},4,10}, {{0,2,1,-2},4,10},
+      {{0,2,-1,0},4,8}, {{0,2,-1,0},4,8}, {{0,2,-1,0},4,8}, {{0,2,-1,0},4,8},
+      {{0,2,-1,1},4,10}, {{0,2,-1,-1},4,10}, {{0,2,-1,2},4,10}, {{0,2,-1,-2},4,10},
+      {{0,2,2,0},4,8}, {{0,2,2,0},4,8}, {{0,2,2,0},4,8}, {{0,2,2,0},4,8},
+      {{0,2,2,1},4,10}, {{0,2,2,-1},4,10}, {{0,2,2,2},4,10}, {{0,2,2,-2},4,10},
+      {{0,2,-2,0},4,8}, {{0,2,-2,0},4,8}, {{0,2,-2,0},4,8}, {{0,2,-2,0},4,8},
+      {{0,2,-2,1},4,10}, {{0,2,-2,-1},4,10}, {{0,2,-2,2},4,10}, {{0,2,-2,-2},4,10},
+      {{0,-2,0,0},4,6}, {{0,-2,0,0},4,6}, {{0,-2,0,0},4,6}, {{0,-2,0,0},4,6},
+      {{0,-2,0,0},4,6}, {{0,-2,0,0},4,6}, {{0,-2,0,0},4,6}, {{0,-2,0,0},4,6},
+      {{0,-2,0,0},4,6}, {{0,-2,0,0},4,6}, {{0,-2,0,0},4,6}, {{0,-2,0,0},4,6},
+      {{0,-2,0,0},4,6}, {{0,-2,0,0},4,6}, {{0,-2,0,0},4,6}, {{0,-2,0,0},4,6},
+      {{0,-2,0,1},4,8}, {{0,-2,0,1},4,8}, {{0,-2,0,1},4,8}, {{0,-2,0,1},4,8},
+      {{0,-2,0,-1},4,8}, {{0,-2,0,-1},4,8}, {{0,-2,0,-1},4,8}, {{0,-2,0,-1},4,8},
+      {{0,-2,0,2},4,8}, {{0,-2,0,2},4,8}, {{0,-2,0,2},4,8}, {{0,-2,0,2},4,8},
+      {{0,-2,0,-2},4,8}, {{0,-2,0,-2},4,8}, {{0,-2,0,-2},4,8}, {{0,-2,0,-2},4,8},
+      {{0,-2,1,0},4,8}, {{0,-2,1,0},4,8}, {{0,-2,1,0},4,8}, {{0,-2,1,0},4,8},
+      {{0,-2,1,1},4,10}, {{0,-2,1,-1},4,10}, {{0,-2,1,2},4,10}, {{0,-2,1,-2},4,10},
+      {{0,-2,-1,0},4,8}, {{0,-2,-1,0},4,8}, {{0,-2,-1,0},4,8}, {{0,-2,-1,0},4,8},
+      {{0,-2,-1,1},4,10}, {{0,-2,-1,-1},4,10}, {{0,-2,-1,2},4,10}, {{0,-2,-1,-2},4,10},
+      {{0,-2,2,0},4,8}, {{0,-2,2,0},4,8}, {{0,-2,2,0},4,8}, {{0,-2,2,0},4,8},
+      {{0,-2,2,1},4,10}, {{0,-2,2,-1},4,10}, {{0,-2,2,2},4,10}, {{0,-2,2,-2},4,10},
+      {{0,-2,-2,0},4,8}, {{0,-2,-2,0},4,8}, {{0,-2,-2,0},4,8}, {{0,-2,-2,0},4,8},
+      {{0,-2,-2,1},4,10}, {{0,-2,-2,-1},4,10}, {{0,-2,-2,2},4,10}, {{0,-2,-2,-2},4,10},
+      {{1,0,0,0},4,6}, {{1,0,0,0},4,6}, {{1,0,0,0},4,6}, {{1,0,0,0},4,6},
+      {{1,0,0,0},4,6}, {{1,0,0,0},4,6}, {{1,0,0,0},4,6}, {{1,0,0,0},4,6},
+      {{1,0,0,0},4,6}, {{1,0,0,0},4,6}, {{1,0,0,0},4,6}, {{1,0,0,0},4,6},
+      {{1,0,0,0},4,6}, {{1,0,0,0},4,6}, {{1,0,0,0},4,6}, {{1,0,0,0},4,6},
+      {{1,0,0,1},4,8}, {{1,0,0,1},4,8}, {{1,0,0,1},4,8}, {{1,0,0,1},4,8},
+      {{1,0,0,-1},4,8}, {{1,0,0,-1},4,8}, {{1,0,0,-1},4,8}, {{1,0,0,-1},4,8},
+      {{1,0,0,2},4,8}, {{1,0,0,2},4,8}, {{1,0,0,2},4,8}, {{1,0,0,2},4,8},
+      {{1,0,0,-2},4,8}, {{1,0,0,-2},4,8}, {{1,0,0,-2},4,8}, {{1,0,0,-2},4,8},
+      {{1,0,1,0},4,8}, {{1,0,1,0},4,8}, {{1,0,1,0},4,8}, {{1,0,1,0},4,8},
+      {{1,0,1,1},4,10}, {{1,0,1,-1},4,10}, {{1,0,1,2},4,10}, {{1,0,1,-2},4,10},
+      {{1,0,-1,0},4,8}, {{1,0,-1,0},4,8}, {{1,0,-1,0},4,8}, {{1,0,-1,0},4,8},
+      {{1,0,-1,1},4,10}, {{1,0,-1,-1},4,10}, {{1,0,-1,2},4,10}, {{1,0,-1,-2},4,10},
+      {{1,0,2,0},4,8}, {{1,0,2,0},4,8}, {{1,0,2,0},4,8}, {{1,0,2,0},4,8},
+      {{1,0,2,1},4,10}, {{1,0,2,-1},4,10}, {{1,0,2,2},4,10}, {{1,0,2,-2},4,10},
+      {{1,0,-2,0},4,8}, {{1,0,-2,0},4,8}, {{1,0,-2,0},4,8}, {{1,0,-2,0},4,8},
+      {{1,0,-2,1},4,10}, {{1,0,-2,-1},4,10}, {{1,0,-2,2},4,10}, {{1,0,-2,-2},4,10},
+      {{1,1,0,0},4,8}, {{1,1,0,0},4,8}, {{1,1,0,0},4,8}, {{1,1,0,0},4,8},
+      {{1,1,0,1},4,10}, {{1,1,0,-1},4,10}, {{1,1,0,2},4,10}, {{1,1,0,-2},4,10},
+      {{1,1,1,0},4,10}, {{1,1,1,0},3,9}, {{1,1,-1,0},4,10}, {{1,1,-1,0},3,9},
+      {{1,1,2,0},4,10}, {{1,1,2,0},3,9}, {{1,1,-2,0},4,10}, {{1,1,-2,0},3,9},
+      {{1,-1,0,0},4,8}, {{1,-1,0,0},4,8}, {{1,-1,0,0},4,8}, {{1,-1,0,0},4,8},
+      {{1,-1,0,1},4,10}, {{1,-1,0,-1},4,10}, {{1,-1,0,2},4,10}, {{1,-1,0,-2},4,10},
+      {{1,-1,1,0},4,10}, {{1,-1,1,0},3,9}, {{1,-1,-1,0},4,10}, {{1,-1,-1,0},3,9},
+      {{1,-1,2,0},4,10}, {{1,-1,2,0},3,9}, {{1,-1,-2,0},4,10}, {{1,-1,-2,0},3,9},
+      {{1,2,0,0},4,8}, {{1,2,0,0},4,8}, {{1,2,0,0},4,8}, {{1,2,0,0},4,8},
+      {{1,2,0,1},4,10}, {{1,2,0,-1},4,10}, {{1,2,0,2},4,10}, {{1,2,0,-2},4,10},
+      {{1,2,1,0},4,10}, {{1,2,1,0},3,9}, {{1,2,-1,0},4,10}, {{1,2,-1,0},3,9},
+      {{1,2,2,0},4,10}, {{1,2,2,0},3,9}, {{1,2,-2,0},4,10}, {{1,2,-2,0},3,9},
+      {{1,-2,0,0},4,8}, {{1,-2,0,0},4,8}, {{1,-2,0,0},4,8}, {{1,-2,0,0},4,8},
+      {{1,-2,0,1},4,10}, {{1,-2,0,-1},4,10}, {{1,-2,0,2},4,10}, {{1,-2,0,-2},4,10},
+      {{1,-2,1,0},4,10}, {{1,-2,1,0},3,9}, {{1,-2,-1,0},4,10}, {{1,-2,-1,0},3,9},
+      {{1,-2,2,0},4,10}, {{1,-2,2,0},3,9}, {{1,-2,-2,0},4,10}, {{1,-2,-2,0},3,9},
+      {{-1,0,0,0},4,6}, {{-1,0,0,0},4,6}, {{-1,0,0,0},4,6}, {{-1,0,0,0},4,6},
+      {{-1,0,0,0},4,6}, {{-1,0,0,0},4,6}, {{-1,0,0,0},4,6}, {{-1,0,0,0},4,6},
+      {{-1,0,0,0},4,6}, {{-1,0,0,0},4,6}, {{-1,0,0,0},4,6}, {{-1,0,0,0},4,6},
+      {{-1,0,0,0},4,6}, {{-1,0,0,0},4,6}, {{-1,0,0,0},4,6}, {{-1,0,0,0},4,6},
+      {{-1,0,0,1},4,8}, {{-1,0,0,1},4,8}, {{-1,0,0,1},4,8}, {{-1,0,0,1},4,8},
+      {{-1,0,0,-1},4,8}, {{-1,0,0,-1},4,8}, {{-1,0,0,-1},4,8}, {{-1,0,0,-1},4,8},
+      {{-1,0,0,2},4,8}, {{-1,0,0,2},4,8}, {{-1,0,0,2},4,8}, {{-1,0,0,2},4,8},
+      {{-1,0,0,-2},4,8}, {{-1,0,0,-2},4,8}, {{-1,0,0,-2},4,8}, {{-1,0,0,-2},4,8},
+      {{-1,0,1,0},4,8}, {{-1,0,1,0},4,8}, {{-1,0,1,0},4,8}, {{-1,0,1,0},4,8},
+      {{-1,0,1,1},4,10}, {{-1,0,1,-1},4,10}, {{-1,0,1,2},4,10}, {{-1,0,1,-2},4,10},
+      {{-1,0,-1,0},4,8}, {{-1,0,-1,0},4,8}, {{-1,0,-1,0},4,8}, {{-1,0,-1,0},4,8},
+      {{-1,0,-1,1},4,10}, {{-1,0,-1,-1},4,10}, {{-1,0,-1,2},4,10}, {{-1,0,-1,-2},4,10},
+      {{-1,0,2,0},4,8}, {{-1,0,2,0},4,8}, {{-1,0,2,0},4,8}, {{-1,0,2,0},4,8},
+      {{-1,0,2,1},4,10}, {{-1,0,2,-1},4,10}, {{-1,0,2,2},4,10}, {{-1,0,2,-2},4,10},
+      {{-1,0,-2,0},4,8}, {{-1,0,-2,0},4,8}, {{-1,0,-2,0},4,8}, {{-1,0,-2,0},4,8},
+      {{-1,0,-2,1},4,10}, {{-1,0,-2,-1},4,10}, {{-1,0,-2,2},4,10}, {{-1,0,-2,-2},4,10},
+      {{-1,1,0,0},4,8}, {{-1,1,0,0},4,8}, {{-1,1,0,0},4,8}, {{-1,1,0,0},4,8},
+      {{-1,1,0,1},4,10}, {{-1,1,0,-1},4,10}, {{-1,1,0,2},4,10}, {{-1,1,0,-2},4,10},
+      {{-1,1,1,0},4,10}, {{-1,1,1,0},3,9}, {{-1,1,-1,0},4,10}, {{-1,1,-1,0},3,9},
+      {{-1,1,2,0},4,10}, {{-1,1,2,0},3,9}, {{-1,1,-2,0},4,10}, {{-1,1,-2,0},3,9},
+      {{-1,-1,0,0},4,8}, {{-1,-1,0,0},4,8}, {{-1,-1,0,0},4,8}, {{-1,-1,0,0},4,8},
+      {{-1,-1,0,1},4,10}, {{-1,-1,0,-1},4,10}, {{-1,-1,0,2},4,10}, {{-1,-1,0,-2},4,10},
+      {{-1,-1,1,0},4,10}, {{-1,-1,1,0},3,9}, {{-1,-1,-1,0},4,10}, {{-1,-1,-1,0},3,9},
+      {{-1,-1,2,0},4,10}, {{-1,-1,2,0},3,9}, {{-1,-1,-2,0},4,10}, {{-1,-1,-2,0},3,9},
+      {{-1,2,0,0},4,8}, {{-1,2,0,0},4,8}, {{-1,2,0,0},4,8}, {{-1,2,0,0},4,8},
+      {{-1,2,0,1},4,10}, {{-1,2,0,-1},4,10}, {{-1,2,0,2},4,10}, {{-1,2,0,-2},4,10},
+      {{-1,2,1,0},4,10}, {{-1,2,1,0},3,9}, {{-1,2,-1,0},4,10}, {{-1,2,-1,0},3,9},
+      {{-1,2,2,0},4,10}, {{-1,2,2,0},3,9}, {{-1,2,-2,0},4,10}, {{-1,2,-2,0},3,9},
+      {{-1,-2,0,0},4,8}, {{-1,-2,0,0},4,8}, {{-1,-2,0,0},4,8}, {{-1,-2,0,0},4,8},
+      {{-1,-2,0,1},4,10}, {{-1,-2,0,-1},4,10}, {{-1,-2,0,2},4,10}, {{-1,-2,0,-2},4,10},
+      {{-1,-2,1,0},4,10}, {{-1,-2,1,0},3,9}, {{-1,-2,-1,0},4,10}, {{-1,-2,-1,0},3,9},
+      {{-1,-2,2,0},4,10}, {{-1,-2,2,0},3,9}, {{-1,-2,-2,0},4,10}, {{-1,-2,-2,0},3,9},
+      {{2,0,0,0},4,6}, {{2,0,0,0},4,6}, {{2,0,0,0},4,6}, {{2,0,0,0},4,6},
+      {{2,0,0,0},4,6}, {{2,0,0,0},4,6}, {{2,0,0,0},4,6}, {{2,0,0,0},4,6},
+      {{2,0,0,0},4,6}, {{2,0,0,0},4,6}, {{2,0,0,0},4,6}, {{2,0,0,0},4,6},
+      {{2,0,0,0},4,6}, {{2,0,0,0},4,6}, {{2,0,0,0},4,6}, {{2,0,0,0},4,6},
+      {{2,0,0,1},4,8}, {{2,0,0,1},4,8}, {{2,0,0,1},4,8}, {{2,0,0,1},4,8},
+      {{2,0,0,-1},4,8}, {{2,0,0,-1},4,8}, {{2,0,0,-1},4,8}, {{2,0,0,-1},4,8},
+      {{2,0,0,2},4,8}, {{2,0,0,2},4,8}, {{2,0,0,2},4,8}, {{2,0,0,2},4,8},
+      {{2,0,0,-2},4,8}, {{2,0,0,-2},4,8}, {{2,0,0,-2},4,8}, {{2,0,0,-2},4,8},
+      {{2,0,1,0},4,8}, {{2,0,1,0},4,8}, {{2,0,1,0},4,8}, {{2,0,1,0},4,8},
+      {{2,0,1,1},4,10}, {{2,0,1,-1},4,10}, {{2,0,1,2},4,10}, {{2,0,1,-2},4,10},
+      {{2,0,-1,0},4,8}, {{2,0,-1,0},4,8}, {{2,0,-1,0},4,8}, {{2,0,-1,0},4,8},
+      {{2,0,-1,1},4,10}, {{2,0,-1,-1},4,10}, {{2,0,-1,2},4,10}, {{2,0,-1,-2},4,10},
+      {{2,0,2,0},4,8}, {{2,0,2,0},4,8}, {{2,0,2,0},4,8}, {{2,0,2,0},4,8},
+      {{2,0,2,1},4,10}, {{2,0,2,-1},4,10}, {{2,0,2,2},4,10}, {{2,0,2,-2},4,10},
+      {{2,0,-2,0},4,8}, {{2,0,-2,0},4,8}, {{2,0,-2,0},4,8}, {{2,0,-2,0},4,8},
+      {{2,0,-2,1},4,10}, {{2,0,-2,-1},4,10}, {{2,0,-2,2},4,10}, {{2,0,-2,-2},4,10},
+      {{2,1,0,0},4,8}, {{2,1,0,0},4,8}, {{2,1,0,0},4,8}, {{2,1,0,0},4,8},
+      {{2,1,0,1},4,10}, {{2,1,0,-1},4,10}, {{2,1,0,2},4,10}, {{2,1,0,-2},4,10},
+      {{2,1,1,0},4,10}, {{2,1,1,0},3,9}, {{2,1,-1,0},4,10}, {{2,1,-1,0},3,9},
+      {{2,1,2,0},4,10}, {{2,1,2,0},3,9}, {{2,1,-2,0},4,10}, {{2,1,-2,0},3,9},
+      {{2,-1,0,0},4,8}, {{2,-1,0,0},4,8}, {{2,-1,0,0},4,8}, {{2,-1,0,0},4,8},
+      {{2,-1,0,1},4,10}, {{2,-1,0,-1},4,10}, {{2,-1,0,2},4,10}, {{2,-1,0,-2},4,10},
+      {{2,-1,1,0},4,10}, {{2,-1,1,0},3,9}, {{2,-1,-1,0},4,10}, {{2,-1,-1,0},3,9},
+      {{2,-1,2,0},4,10}, {{2,-1,2,0},3,9}, {{2,-1,-2,0},4,10}, {{2,-1,-2,0},3,9},
+      {{2,2,0,0},4,8}, {{2,2,0,0},4,8}, {{2,2,0,0},4,8}, {{2,2,0,0},4,8},
+      {{2,2,0,1},4,10}, {{2,2,0,-1},4,10}, {{2,2,0,2},4,10}, {{2,2,0,-2},4,10},
+      {{2,2,1,0},4,10}, {{2,2,1,0},3,9}, {{2,2,-1,0},4,10}, {{2,2,-1,0},3,9},
+      {{2,2,2,0},4,10}, {{2,2,2,0},3,9}, {{2,2,-2,0},4,10}, {{2,2,-2,0},3,9},
+      {{2,-2,0,0},4,8}, {{2,-2,0,0},4,8}, {{2,-2,0,0},4,8}, {{2,-2,0,0},4,8},
+      {{2,-2,0,1},4,10}, {{2,-2,0,-1},4,10}, {{2,-2,0,2},4,10}, {{2,-2,0,-2},4,10},
+      {{2,-2,1,0},4,10}, {{2,-2,1,0},3,9}, {{2,-2,-1,0},4,10}, {{2,-2,-1,0},3,9},
+      {{2,-2,2,0},4,10}, {{2,-2,2,0},3,9}, {{2,-2,-2,0},4,10}, {{2,-2,-2,0},3,9},
+      {{-2,0,0,0},4,6}, {{-2,0,0,0},4,6}, {{-2,0,0,0},4,6}, {{-2,0,0,0},4,6},
+      {{-2,0,0,0},4,6}, {{-2,0,0,0},4,6}, {{-2,0,0,0},4,6}, {{-2,0,0,0},4,6},
+      {{-2,0,0,0},4,6}, {{-2,0,0,0},4,6}, {{-2,0,0,0},4,6}, {{-2,0,0,0},4,6},
+      {{-2,0,0,0},4,6}, {{-2,0,0,0},4,6}, {{-2,0,0,0},4,6}, {{-2,0,0,0},4,6},
+      {{-2,0,0,1},4,8}, {{-2,0,0,1},4,8}, {{-2,0,0,1},4,8}, {{-2,0,0,1},4,8},
+      {{-2,0,0,-1},4,8}, {{-2,0,0,-1},4,8}, {{-2,0,0,-1},4,8}, {{-2,0,0,-1},4,8},
+      {{-2,0,0,2},4,8}, {{-2,0,0,2},4,8}, {{-2,0,0,2},4,8}, {{-2,0,0,2},4,8},
+      {{-2,0,0,-2},4,8}, {{-2,0,0,-2},4,8}, {{-2,0,0,-2},4,8}, {{-2,0,0,-2},4,8},
+      {{-2,0,1,0},4,8}, {{-2,0,1,0},4,8}, {{-2,0,1,0},4,8}, {{-2,0,1,0},4,8},
+      {{-2,0,1,1},4,10}, {{-2,0,1,-1},4,10}, {{-2,0,1,2},4,10}, {{-2,0,1,-2},4,10},
+      {{-2,0,-1,0},4,8}, {{-2,0,-1,0},4,8}, {{-2,0,-1,0},4,8}, {{-2,0,-1,0},4,8},
+      {{-2,0,-1,1},4,10}, {{-2,0,-1,-1},4,10}, {{-2,0,-1,2},4,10}, {{-2,0,-1,-2},4,10},
+      {{-2,0,2,0},4,8}, {{-2,0,2,0},4,8}, {{-2,0,2,0},4,8}, {{-2,0,2,0},4,8},
+      {{-2,0,2,1},4,10}, {{-2,0,2,-1},4,10}, {{-2,0,2,2},4,10}, {{-2,0,2,-2},4,10},
+      {{-2,0,-2,0},4,8}, {{-2,0,-2,0},4,8}, {{-2,0,-2,0},4,8}, {{-2,0,-2,0},4,8},
+      {{-2,0,-2,1},4,10}, {{-2,0,-2,-1},4,10}, {{-2,0,-2,2},4,10}, {{-2,0,-2,-2},4,10},
+      {{-2,1,0,0},4,8}, {{-2,1,0,0},4,8}, {{-2,1,0,0},4,8}, {{-2,1,0,0},4,8},
+      {{-2,1,0,1},4,10}, {{-2,1,0,-1},4,10}, {{-2,1,0,2},4,10}, {{-2,1,0,-2},4,10},
+      {{-2,1,1,0},4,10}, {{-2,1,1,0},3,9}, {{-2,1,-1,0},4,10}, {{-2,1,-1,0},3,9},
+      {{-2,1,2,0},4,10}, {{-2,1,2,0},3,9}, {{-2,1,-2,0},4,10}, {{-2,1,-2,0},3,9},
+      {{-2,-1,0,0},4,8}, {{-2,-1,0,0},4,8}, {{-2,-1,0,0},4,8}, {{-2,-1,0,0},4,8},
+      {{-2,-1,0,1},4,10}, {{-2,-1,0,-1},4,10}, {{-2,-1,0,2},4,10}, {{-2,-1,0,-2},4,10},
+      {{-2,-1,1,0},4,10}, {{-2,-1,1,0},3,9}, {{-2,-1,-1,0},4,10}, {{-2,-1,-1,0},3,9},
+      {{-2,-1,2,0},4,10}, {{-2,-1,2,0},3,9}, {{-2,-1,-2,0},4,10}, {{-2,-1,-2,0},3,9},
+      {{-2,2,0,0},4,8}, {{-2,2,0,0},4,8}, {{-2,2,0,0},4,8}, {{-2,2,0,0},4,8},
+      {{-2,2,0,1},4,10}, {{-2,2,0,-1},4,10}, {{-2,2,0,2},4,10}, {{-2,2,0,-2},4,10},
+      {{-2,2,1,0},4,10}, {{-2,2,1,0},3,9}, {{-2,2,-1,0},4,10}, {{-2,2,-1,0},3,9},
+      {{-2,2,2,0},4,10}, {{-2,2,2,0},3,9}, {{-2,2,-2,0},4,10}, {{-2,2,-2,0},3,9},
+      {{-2,-2,0,0},4,8}, {{-2,-2,0,0},4,8}, {{-2,-2,0,0},4,8}, {{-2,-2,0,0},4,8},
+      {{-2,-2,0,1},4,10}, {{-2,-2,0,-1},4,10}, {{-2,-2,0,2},4,10}, {{-2,-2,0,-2},4,10},
+      {{-2,-2,1,0},4,10}, {{-2,-2,1,0},3,9}, {{-2,-2,-1,0},4,10}, {{-2,-2,-1,0},3,9},
+      {{-2,-2,2,0},4,10}, {{-2,-2,2,0},3,9}, {{-2,-2,-2,0},4,10}, {{-2,-2,-2,0},3,9},
+    },
+    { // Table 3
+      {{0,0,0,0},4,4}, {{0,0,0,0},4,4}, {{0,0,0,0},4,4}, {{0,0,0,0},4,4},
+      {{0,0,0,0},4,4}, {{0,0,0,0},4,4}, {{0,0,0,0},4,4}, {{0,0,0,0},4,4},
+      {{0,0,0,0},4,4}, {{0,0,0,0},4,4}, {{0,0,0,0},4,4}, {{0,0,0,0},4,4},
+      {{0,0,0,0},4,4}, {{0,0,0,0},4,4}, {{0,0,0,0},4,4}, {{0,0,0,0},4,4},
+      {{0,0,0,0},4,4}, {{0,0,0,0},4,4}, {{0,0,0,0},4,4}, {{0,0,0,0},4,4},
+      {{0,0,0,0},4,4}, {{0,0,0,0},4,4}, {{0,0,0,0},4,4}, {{0,0,0,0},4,4},
+      {{0,0,0,0},4,4}, {{0,0,0,0},4,4}, {{0,0,0,0},4,4}, {{0,0,0,0},4,4},
+      {{0,0,0,0},4,4}, {{0,0,0,0},4,4}, {{0,0,0,0},4,4}, {{0,0,0,0},4,4},
+      {{0,0,0,0},4,4}, {{0,0,0,0},4,4}, {{0,0,0,0},4,4}, {{0,0,0,0},4,4},
+      {{0,0,0,0},4,4}, {{0,0,0,0},4,4}, {{0,0,0,0},4,4}, {{0,0,0,0},4,4},
+      {{0,0,0,0},4,4}, {{0,0,0,0},4,4}, {{0,0,0,0},4,4}, {{0,0,0,0},4,4},
+      {{0,0,0,0},4,4}, {{0,0,0,0},4,4}, {{0,0,0,0},4,4}, {{0,0,0,0},4,4},
+      {{0,0,0,0},4,4}, {{0,0,0,0},4,4}, {{0,0,0,0},4,4}, {{0,0,0,0},4,4},
+      {{0,0,0,0},4,4}, {{0,0,0,0},4,4}, {{0,0,0,0},4,4}, {{0,0,0,0},4,4},
+      {{0,0,0,0},4,4}, {{0,0,0,0},4,4}, {{0,0,0,0},4,4}, {{0,0,0,0},4,4},
+      {{0,0,0,0},4,4}, {{0,0,0,0},4,4}, {{0,0,0,0},4,4}, {{0,0,0,0},4,4},
+      {{0,0,0,1},4,6}, {{0,0,0,1},4,6}, {{0,0,0,1},4,6}, {{0,0,0,1},4,6},
+      {{0,0,0,1},4,6}, {{0,0,0,1},4,6}, {{0,0,0,1},4,6}, {{0,0,0,1},4,6},
+      {{0,0,0,1},4,6}, {{0,0,0,1},4,6}, {{0,0,0,1},4,6}, {{0,0,0,1},4,6},
+      {{0,0,0,1},4,6}, {{0,0,0,1},4,6}, {{0,0,0,1},4,6}, {{0,0,0,1},4,6},
+      {{0,0,0,-1},4,6}, {{0,0,0,-1},4,6}, {{0,0,0,-1},4,6}, {{0,0,0,-1},4,6},
+      {{0,0,0,-1},4,6}, {{0,0,0,-1},4,6}, {{0,0,0,-1},4,6}, {{0,0,0,-1},4,6},
+      {{0,0,0,-1},4,6}, {{0,0,0,-1},4,6}, {{0,0,0,-1},4,6}, {{0,0,0,-1},4,6},
+      {{0,0,0,-1},4,6}, {{0,0,0,-1},4,6}, {{0,0,0,-1},4,6}, {{0,0,0,-1},4,6},
+      {{0,0,0,2},4,7}, {{0,0,0,2},4,7}, {{0,0,0,2},4,7}, {{0,0,0,2},4,7},
+      {{0,0,0,2},4,7}, {{0,0,0,2},4,7}, {{0,0,0,2},4,7}, {{0,0,0,2},4,7},
+      {{0,0,0,-2},4,7}, {{0,0,0,-2},4,7}, {{0,0,0,-2},4,7}, {{0,0,0,-2},4,7},
+      {{0,0,0,-2},4,7}, {{0,0,0,-2},4,7}, {{0,0,0,-2},4,7}, {{0,0,0,-2},4,7},
+      {{0,0,0,3},4,7}, {{0,0,0,3},4,7}, {{0,0,0,3},4,7}, {{0,0,0,3},4,7},
+      {{0,0,0,3},4,7}, {{0,0,0,3},4,7}, {{0,0,0,3},4,7}, {{0,0,0,3},4,7},
+      {{0,0,0,-3},4,7}, {{0,0,0,-3},4,7}, {{0,0,0,-3},4,7}, {{0,0,0,-3},4,7},
+      {{0,0,0,-3},4,7}, {{0,0,0,-3},4,7}, {{0,0,0,-3},4,7}, {{0,0,0,-3},4,7},
+      {{0,0,1,0},4,6}, {{0,0,1,0},4,6}, {{0,0,1,0},4,6}, {{0,0,1,0},4,6},
+      {{0,0,1,0},4,6}, {{0,0,1,0},4,6}, {{0,0,1,0},4,6}, {{0,0,1,0},4,6},
+      {{0,0,1,0},4,6}, {{0,0,1,0},4,6}, {{0,0,1,0},4,6}, {{0,0,1,0},4,6},
+      {{0,0,1,0},4,6}, {{0,0,1,0},4,6}, {{0,0,1,0},4,6}, {{0,0,1,0},4,6},
+      {{0,0,1,1},4,8}, {{0,0,1,1},4,8}, {{0,0,1,1},4,8}, {{0,0,1,1},4,8},
+      {{0,0,1,-1},4,8}, {{0,0,1,-1},4,8}, {{0,0,1,-1},4,8}, {{0,0,1,-1},4,8},
+      {{0,0,1,2},4,9}, {{0,0,1,2},4,9}, {{0,0,1,-2},4,9}, {{0,0,1,-2},4,9},
+      {{0,0,1,3},4,9}, {{0,0,1,3},4,9}, {{0,0,1,-3},4,9}, {{0,0,1,-3},4,9},
+      {{0,0,-1,0},4,6}, {{0,0,-1,0},4,6}, {{0,0,-1,0},4,6}, {{0,0,-1,0},4,6},
+      {{0,0,-1,0},4,6}, {{0,0,-1,0},4,6}, {{0,0,-1,0},4,6}, {{0,0,-1,0},4,6},
+      {{0,0,-1,0},4,6}, {{0,0,-1,0},4,6}, {{0,0,-1,0},4,6}, {{0,0,-1,0},4,6},
+      {{0,0,-1,0},4,6}, {{0,0,-1,0},4,6}, {{0,0,-1,0},4,6}, {{0,0,-1,0},4,6},
+      {{0,0,-1,1},4,8}, {{0,0,-1,1},4,8}, {{0,0,-1,1},4,8}, {{0,0,-1,1},4,8},
+      {{0,0,-1,-1},4,8}, {{0,0,-1,-1},4,8}, {{0,0,-1,-1},4,8}, {{0,0,-1,-1},4,8},
+      {{0,0,-1,2},4,9}, {{0,0,-1,2},4,9}, {{0,0,-1,-2},4,9}, {{0,0,-1,-2},4,9},
+      {{0,0,-1,3},4,9}, {{0,0,-1,3},4,9}, {{0,0,-1,-3},4,9}, {{0,0,-1,-3},4,9},
+      {{0,0,2,0},4,7}, {{0,0,2,0},4,7}, {{0,0,2,0},4,7}, {{0,0,2,0},4,7},
+      {{0,0,2,0},4,7}, {{0,0,2,0},4,7}, {{0,0,2,0},4,7}, {{0,0,2,0},4,7},
+      {{0,0,2,1},4,9}, {{0,0,2,1},4,9}, {{0,0,2,-1},4,9}, {{0,0,2,-1},4,9},
+      {{0,0,2,2},4,10}, {{0,0,2,-2},4,10}, {{0,0,2,3},4,10}, {{0,0,2,-3},4,10},
+      {{0,0,-2,0},4,7}, {{0,0,-2,0},4,7}, {{0,0,-2,0},4,7}, {{0,0,-2,0},4,7},
+      {{0,0,-2,0},4,7}, {{0,0,-2,0},4,7}, {{0,0,-2,0},4,7}, {{0,0,-2,0},4,7},
+      {{0,0,-2,1},4,9}, {{0,0,-2,1},4,9}, {{0,0,-2,-1},4,9}, {{0,0,-2,-1},4,9},
+      {{0,0,-2,2},4,10}, {{0,0,-2,-2},4,10}, {{0,0,-2,3},4,10}, {{0,0,-2,-3},4,10},
+      {{0,0,3,0},4,7}, {{0,0,3,0},4,7}, {{0,0,3,0},4,7}, {{0,0,3,0},4,7},
+      {{0,0,3,0},4,7}, {{0,0,3,0},4,7}, {{0,0,3,0},4,7}, {{0,0,3,0},4,7},
+      {{0,0,3,1},4,9}, {{0,0,3,1},4,9}, {{0,0,3,-1},4,9}, {{0,0,3,-1},4,9},
+      {{0,0,3,2},4,10}, {{0,0,3,-2},4,10}, {{0,0,3,3},4,10}, {{0,0,3,-3},4,10},
+      {{0,0,-3,0},4,7}, {{0,0,-3,0},4,7}, {{0,0,-3,0},4,7}, {{0,0,-3,0},4,7},
+      {{0,0,-3,0},4,7}, {{0,0,-3,0},4,7}, {{0,0,-3,0},4,7}, {{0,0,-3,0},4,7},
+      {{0,0,-3,1},4,9}, {{0,0,-3,1},4,9}, {{0,0,-3,-1},4,9}, {{0,0,-3,-1},4,9},
+      {{0,0,-3,2},4,10}, {{0,0,-3,-2},4,10}, {{0,0,-3,3},4,10}, {{0,0,-3,-3},4,10},
+      {{0,1,0,0},4,6}, {{0,1,0,0},4,6}, {{0,1,0,0},4,6}, {{0,1,0,0},4,6},
+      {{0,1,0,0},4,6}, {{0,1,0,0},4,6}, {{0,1,0,0},4,6}, {{0,1,0,0},4,6},
+      {{0,1,0,0},4,6}, {{0,1,0,0},4,6}, {{0,1,0,0},4,6}, {{0,1,0,0},4,6},
+      {{0,1,0,0},4,6}, {{0,1,0,0},4,6}, {{0,1,0,0},4,6}, {{0,1,0,0},4,6},
+      {{0,1,0,1},4,8}, {{0,1,0,1},4,8}, {{0,1,0,1},4,8}, {{0,1,0,1},4,8},
+      {{0,1,0,-1},4,8}, {{0,1,0,-1},4,8}, {{0,1,0,-1},4,8}, {{0,1,0,-1},4,8},
+      {{0,1,0,2},4,9}, {{0,1,0,2},4,9}, {{0,1,0,-2},4,9}, {{0,1,0,-2},4,9},
+      {{0,1,0,3},4,9}, {{0,1,0,3},4,9}, {{0,1,0,-3},4,9}, {{0,1,0,-3},4,9},
+      {{0,1,1,0},4,8}, {{0,1,1,0},4,8}, {{0,1,1,0},4,8}, {{0,1,1,0},4,8},
+      {{0,1,1,1},4,10}, {{0,1,1,-1},4,10}, {{0,1,1,0},3,7}, {{0,1,1,0},3,7},
+      {{0,1,-1,0},4,8}, {{0,1,-1,0},4,8}, {{0,1,-1,0},4,8}, {{0,1,-1,0},4,8},
+      {{0,1,-1,1},4,10}, {{0,1,-1,-1},4,10}, {{0,1,-1,0},3,7}, {{0,1,-1,0},3,7},
+      {{0,1,2,0},4,9}, {{0,1,2,0},4,9}, {{0,1,2,0},3,8}, {{0,1,2,0},3,8},
+      {{0,1,-2,0},4,9}, {{0,1,-2,0},4,9}, {{0,1,-2,0},3,8}, {{0,1,-2,0},3,8},
+      {{0,1,3,0},4,9}, {{0,1,3,0},4,9}, {{0,1,3,0},3,8}, {{0,1,3,0},3,8},
+      {{0,1,-3,0},4,9}, {{0,1,-3,0},4,9}, {{0,1,-3,0},3,8}, {{0,1,-3,0},3,8},
+      {{0,-1,0,0},4,6}, {{0,-1,0,0},4,6}, {{0,-1,0,0},4,6}, {{0,-1,0,0},4,6},
+      {{0,-1,0,0},4,6}, {{0,-1,0,0},4,6}, {{0,-1,0,0},4,6}, {{0,-1,0,0},4,6},
+      {{0,-1,0,0},4,6}, {{0,-1,0,0},4,6}, {{0,-1,0,0},4,6}, {{0,-1,0,0},4,6},
+      {{0,-1,0,0},4,6}, {{0,-1,0,0},4,6}, {{0,-1,0,0},4,6}, {{0,-1,0,0},4,6},
+      {{0,-1,0,1},4,8}, {{0,-1,0,1},4,8}, {{0,-1,0,1},4,8}, {{0,-1,0,1},4,8},
+      {{0,-1,0,-1},4,8}, {{0,-1,0,-1},4,8}, {{0,-1,0,-1},4,8}, {{0,-1,0,-1},4,8},
+      {{0,-1,0,2},4,9}, {{0,-1,0,2},4,9}, {{0,-1,0,-2},4,9}, {{0,-1,0,-2},4,9},
+      {{0,-1,0,3},4,9}, {{0,-1,0,3},4,9}, {{0,-1,0,-3},4,9}, {{0,-1,0,-3},4,9},
+      {{0,-1,1,0},4,8}, {{0,-1,1,0},4,8}, {{0,-1,1,0},4,8}, {{0,-1,1,0},4,8},
+      {{0,-1,1,1},4,10}, {{0,-1,1,-1},4,10}, {{0,-1,1,0},3,7}, {{0,-1,1,0},3,7},
+      {{0,-1,-1,0},4,8}, {{0,-1,-1,0},4,8}, {{0,-1,-1,0},4,8}, {{0,-1,-1,0},4,8},
+      {{0,-1,-1,1},4,10}, {{0,-1,-1,-1},4,10}, {{0,-1,-1,0},3,7}, {{0,-1,-1,0},3,7},
+      {{0,-1,2,0},4,9}, {{0,-1,2,0},4,9}, {{0,-1,2,0},3,8}, {{0,-1,2,0},3,8},
+      {{0,-1,-2,0},4,9}, {{0,-1,-2,0},4,9}, {{0,-1,-2,0},3,8}, {{0,-1,-2,0},3,8},
+      {{0,-1,3,0},4,9}, {{0,-1,3,0},4,9}, {{0,-1,3,0},3,8}, {{0,-1,3,0},3,8},
+      {{0,-1,-3,0},4,9}, {{0,-1,-3,0},4,9}, {{0,-1,-3,0},3,8}, {{0,-1,-3,0},3,8},
+      {{0,2,0,0},4,7}, {{0,2,0,0},4,7}, {{0,2,0,0},4,7}, {{0,2,0,0},4,7},
+      {{0,2,0,0},4,7}, {{0,2,0,0},4,7}, {{0,2,0,0},4,7}, {{0,2,0,0},4,7},
+      {{0,2,0,1},4,9}, {{0,2,0,1},4,9}, {{0,2,0,-1},4,9}, {{0,2,0,-1},4,9},
+      {{0,2,0,2},4,10}, {{0,2,0,-2},4,10}, {{0,2,0,3},4,10}, {{0,2,0,-3},4,10},
+      {{0,2,1,0},4,9}, {{0,2,1,0},4,9}, {{0,2,1,0},3,8}, {{0,2,1,0},3,8},
+      {{0,2,-1,0},4,9}, {{0,2,-1,0},4,9}, {{0,2,-1,0},3,8}, {{0,2,-1,0},3,8},
+      {{0,2,2,0},4,10}, {{0,2,2,0},3,9}, {{0,2,-2,0},4,10}, {{0,2,-2,0},3,9},
+      {{0,2,3,0},4,10}, {{0,2,3,0},3,9}, {{0,2,-3,0},4,10}, {{0,2,-3,0},3,9},
+      {{0,-2,0,0},4,7}, {{0,-2,0,0},4,7}, {{0,-2,0,0},4,7}, {{0,-2,0,0},4,7},
+      {{0,-2,0,0},4,7}, {{0,-2,0,0},4,7}, {{0,-2,0,0},4,7}, {{0,-2,0,0},4,7},
+      {{0,-2,0,1},4,9}, {{0,-2,0,1},4,9}, {{0,-2,0,-1},4,9}, {{0,-2,0,-1},4,9},
+      {{0,-2,0,2},4,10}, {{0,-2,0,-2},4,10}, {{0,-2,0,3},4,10}, {{0,-2,0,-3},4,10},
+      {{0,-2,1,0},4,9}, {{0,-2,1,0},4,9}, {{0,-2,1,0},3,8}, {{0,-2,1,0},3,8},
+      {{0,-2,-1,0},4,9}, {{0,-2,-1,0},4,9}, {{0,-2,-1,0},3,8}, {{0,-2,-1,0},3,8},
+      {{0,-2,2,0},4,10}, {{0,-2,2,0},3,9}, {{0,-2,-2,0},4,10}, {{0,-2,-2,0},3,9},
+      {{0,-2,3,0},4,10}, {{0,-2,3,0},3,9}, {{0,-2,-3,0},4,10}, {{0,-2,-3,0},3,9},
+      {{0,3,0,0},4,7}, {{0,3,0,0},4,7}, {{0,3,0,0},4,7}, {{0,3,0,0},4,7},
+      {{0,3,0,0},4,7}, {{0,3,0,0},4,7}, {{0,3,0,0},4,7}, {{0,3,0,0},4,7},
+      {{0,3,0,1},4,9}, {{0,3,0,1},4,9}, {{0,3,0,-1},4,9}, {{0,3,0,-1},4,9},
+      {{0,3,0,2},4,10}, {{0,3,0,-2},4,10}, {{0,3,0,3},4,10}, {{0,3,0,-3},4,10},
+      {{0,3,1,0},4,9}, {{0,3,1,0},4,9}, {{0,3,1,0},3,8}, {{0,3,1,0},3,8},
+      {{0,3,-1,0},4,9}, {{0,3,-1,0},4,9}, {{0,3,-1,0},3,8}, {{0,3,-1,0},3,8},
+      {{0,3,2,0},4,10}, {{0,3,2,0},3,9}, {{0,3,-2,0},4,10}, {{0,3,-2,0},3,9},
+      {{0,3,3,0},4,10}, {{0,3,3,0},3,9}, {{0,3,-3,0},4,10}, {{0,3,-3,0},3,9},
+      {{0,-3,0,0},4,7}, {{0,-3,0,0},4,7}, {{0,-3,0,0},4,7}, {{0,-3,0,0},4,7},
+      {{0,-3,0,0},4,7}, {{0,-3,0,0},4,7}, {{0,-3,0,0},4,7}, {{0,-3,0,0},4,7},
+      {{0,-3,0,1},4,9}, {{0,-3,0,1},4,9}, {{0,-3,0,-1},4,9}, {{0,-3,0,-1},4,9},
+      {{0,-3,0,2},4,10}, {{0,-3,0,-2},4,10}, {{0,-3,0,3},4,10}, {{0,-3,0,-3},4,10},
+      {{0,-3,1,0},4,9}, {{0,-3,1,0},4,9}, {{0,-3,1,0},3,8}, {{0,-3,1,0},3,8},
+      {{0,-3,-1,0},4,9}, {{0,-3,-1,0},4,9}, {{0,-3,-1,0},3,8}, {{0,-3,-1,0},3,8},
+      {{0,-3,2,0},4,10}, {{0,-3,2,0},3,9}, {{0,-3,-2,0},4,10}, {{0,-3,-2,0},3,9},
+      {{0,-3,3,0},4,10}, {{0,-3,3,0},3,9}, {{0,-3,-3,0},4,10}, {{0,-3,-3,0},3,9},
+      {{1,0,0,0},4,6}, {{1,0,0,0},4,6}, {{1,0,0,0},4,6}, {{1,0,0,0},4,6},
+      {{1,0,0,0},4,6}, {{1,0,0,0},4,6}, {{1,0,0,0},4,6}, {{1,0,0,0},4,6},
+      {{1,0,0,0},4,6}, {{1,0,0,0},4,6}, {{1,0,0,0},4,6}, {{1,0,0,0},4,6},
+      {{1,0,0,0},4,6}, {{1,0,0,0},4,6}, {{1,0,0,0},4,6}, {{1,0,0,0},4,6},
+      {{1,0,0,1},4,8}, {{1,0,0,1},4,8}, {{1,0,0,1},4,8}, {{1,0,0,1},4,8},
+      {{1,0,0,-1},4,8}, {{1,0,0,-1},4,8}, {{1,0,0,-1},4,8}, {{1,0,0,-1},4,8},
+      {{1,0,0,2},4,9}, {{1,0,0,2},4,9}, {{1,0,0,-2},4,9}, {{1,0,0,-2},4,9},
+      {{1,0,0,3},4,9}, {{1,0,0,3},4,9}, {{1,0,0,-3},4,9}, {{1,0,0,-3},4,9},
+      {{1,0,1,0},4,8}, {{1,0,1,0},4,8}, {{1,0,1,0},4,8}, {{1,0,1,0},4,8},
+      {{1,0,1,1},4,10}, {{1,0,1,-1},4,10}, {{1,0,1,0},3,7}, {{1,0,1,0},3,7},
+      {{1,0,-1,0},4,8}, {{1,0,-1,0},4,8}, {{1,0,-1,0},4,8}, {{1,0,-1,0},4,8},
+      {{1,0,-1,1},4,10}, {{1,0,-1,-1},4,10}, {{1,0,-1,0},3,7}, {{1,0,-1,0},3,7},
+      {{1,0,2,0},4,9}, {{1,0,2,0},4,9}, {{1,0,2,0},3,8}, {{1,0,2,0},3,8},
+      {{1,0,-2,0},4,9}, {{1,0,-2,0},4,9}, {{1,0,-2,0},3,8}, {{1,0,-2,0},3,8},
+      {{1,0,3,0},4,9}, {{1,0,3,0},4,9}, {{1,0,3,0},3,8}, {{1,0,3,0},3,8},
+      {{1,0,-3,0},4,9}, {{1,0,-3,0},4,9}, {{1,0,-3,0},3,8}, {{1,0,-3,0},3,8},
+      {{1,1,0,0},4,8}, {{1,1,0,0},4,8}, {{1,1,0,0},4,8}, {{1,1,0,0},4,8},
+      {{1,1,0,1},4,10}, {{1,1,0,-1},4,10}, {{1,1,0,0},3,7}, {{1,1,0,0},3,7},
+      {{1,1,1,0},4,10}, {{1,1,1,0},3,9}, {{1,1,-1,0},4,10}, {{1,1,-1,0},3,9},
+      {{1,1,2,0},3,10}, {{1,1,-2,0},3,10}, {{1,1,3,0},3,10}, {{1,1,-3,0},3,10},
+      {{1,-1,0,0},4,8}, {{1,-1,0,0},4,8}, {{1,-1,0,0},4,8}, {{1,-1,0,0},4,8},
+      {{1,-1,0,1},4,10}, {{1,-1,0,-1},4,10}, {{1,-1,0,0},3,7}, {{1,-1,0,0},3,7},
+      {{1,-1,1,0},4,10}, {{1,-1,1,0},3,9}, {{1,-1,-1,0},4,10}, {{1,-1,-1,0},3,9},
+      {{1,-1,2,0},3,10}, {{1,-1,-2,0},3,10}, {{1,-1,3,0},3,10}, {{1,-1,-3,0},3,10},
+      {{1,2,0,0},4,9}, {{1,2,0,0},4,9}, {{1,2,0,0},3,8}, {{1,2,0,0},3,8},
+      {{1,2,1,0},3,10}, {{1,2,-1,0},3,10}, {{1,2,0,0},2,7}, {{1,2,0,0},2,7},
+      {{1,-2,0,0},4,9}, {{1,-2,0,0},4,9}, {{1,-2,0,0},3,8}, {{1,-2,0,0},3,8},
+      {{1,-2,1,0},3,10}, {{1,-2,-1,0},3,10}, {{1,-2,0,0},2,7}, {{1,-2,0,0},2,7},
+      {{1,3,0,0},4,9}, {{1,3,0,0},4,9}, {{1,3,0,0},3,8}, {{1,3,0,0},3,8},
+      {{1,3,1,0},3,10}, {{1,3,-1,0},3,10}, {{1,3,0,0},2,7}, {{1,3,0,0},2,7},
+      {{1,-3,0,0},4,9}, {{1,-3,0,0},4,9}, {{1,-3,0,0},3,8}, {{1,-3,0,0},3,8},
+      {{1,-3,1,0},3,10}, {{1,-3,-1,0},3,10}, {{1,-3,0,0},2,7}, {{1,-3,0,0},2,7},
+      {{-1,0,0,0},4,6}, {{-1,0,0,0},4,6}, {{-1,0,0,0},4,6}, {{-1,0,0,0},4,6},
+      {{-1,0,0,0},4,6}, {{-1,0,0,0},4,6}, {{-1,0,0,0},4,6}, {{-1,0,0,0},4,6},
+      {{-1,0,0,0},4,6}, {{-1,0,0,0},4,6}, {{-1,0,0,0},4,6}, {{-1,0,0,0},4,6},
+      {{-1,0,0,0},4,6}, {{-1,0,0,0},4,6}, {{-1,0,0,0},4,6}, {{-1,0,0,0},4,6},
+      {{-1,0,0,1},4,8}, {{-1,0,0,1},4,8}, {{-1,0,0,1},4,8}, {{-1,0,0,1},4,8},
+      {{-1,0,0,-1},4,8}, {{-1,0,0,-1},4,8}, {{-1,0,0,-1},4,8}, {{-1,0,0,-1},4,8},
+      {{-1,0,0,2},4,9}, {{-1,0,0,2},4,9}, {{-1,0,0,-2},4,9}, {{-1,0,0,-2},4,9},
+      {{-1,0,0,3},4,9}, {{-1,0,0,3},4,9}, {{-1,0,0,-3},4,9}, {{-1,0,0,-3},4,9},
+      {{-1,0,1,0},4,8}, {{-1,0,1,0},4,8}, {{-1,0,1,0},4,8}, {{-1,0,1,0},4,8},
+      {{-1,0,1,1},4,10}, {{-1,0,1,-1},4,10}, {{-1,0,1,0},3,7}, {{-1,0,1,0},3,7},
+      {{-1,0,-1,0},4,8}, {{-1,0,-1,0},4,8}, {{-1,0,-1,0},4,8}, {{-1,0,-1,0},4,8},
+      {{-1,0,-1,1},4,10}, {{-1,0,-1,-1},4,10}, {{-1,0,-1,0},3,7}, {{-1,0,-1,0},3,7},
+      {{-1,0,2,0},4,9}, {{-1,0,2,0},4,9}, {{-1,0,2,0},3,8}, {{-1,0,2,0},3,8},
+      {{-1,0,-2,0},4,9}, {{-1,0,-2,0},4,9}, {{-1,0,-2,0},3,8}, {{-1,0,-2,0},3,8},
+      {{-1,0,3,0},4,9}, {{-1,0,3,0},4,9}, {{-1,0,3,0},3,8}, {{-1,0,3,0},3,8},
+      {{-1,0,-3,0},4,9}, {{-1,0,-3,0},4,9}, {{-1,0,-3,0},3,8}, {{-1,0,-3,0},3,8},
+      {{-1,1,0,0},4,8}, {{-1,1,0,0},4,8}, {{-1,1,0,0},4,8}, {{-1,1,0,0},4,8},
+      {{-1,1,0,1},4,10}, {{-1,1,0,-1},4,10}, {{-1,1,0,0},3,7}, {{-1,1,0,0},3,7},
+      {{-1,1,1,0},4,10}, {{-1,1,1,0},3,9}, {{-1,1,-1,0},4,10}, {{-1,1,-1,0},3,9},
+      {{-1,1,2,0},3,10}, {{-1,1,-2,0},3,10}, {{-1,1,3,0},3,10}, {{-1,1,-3,0},3,10},
+      {{-1,-1,0,0},4,8}, {{-1,-1,0,0},4,8}, {{-1,-1,0,0},4,8}, {{-1,-1,0,0},4,8},
+      {{-1,-1,0,1},4,10}, {{-1,-1,0,-1},4,10}, {{-1,-1,0,0},3,7}, {{-1,-1,0,0},3,7},
+      {{-1,-1,1,0},4,10}, {{-1,-1,1,0},3,9}, {{-1,-1,-1,0},4,10}, {{-1,-1,-1,0},3,9},
+      {{-1,-1,2,0},3,10}, {{-1,-1,-2,0},3,10}, {{-1,-1,3,0},3,10}, {{-1,-1,-3,0},3,10},
+      {{-1,2,0,0},4,9}, {{-1,2,0,0},4,9}, {{-1,2,0,0},3,8}, {{-1,2,0,0},3,8},
+      {{-1,2,1,0},3,10}, {{-1,2,-1,0},3,10}, {{-1,2,0,0},2,7}, {{-1,2,0,0},2,7},
+      {{-1,-2,0,0},4,9}, {{-1,-2,0,0},4,9}, {{-1,-2,0,0},3,8}, {{-1,-2,0,0},3,8},
+      {{-1,-2,1,0},3,10}, {{-1,-2,-1,0},3,10}, {{-1,-2,0,0},2,7}, {{-1,-2,0,0},2,7},
+      {{-1,3,0,0},4,9}, {{-1,3,0,0},4,9}, {{-1,3,0,0},3,8}, {{-1,3,0,0},3,8},
+      {{-1,3,1,0},3,10}, {{-1,3,-1,0},3,10}, {{-1,3,0,0},2,7}, {{-1,3,0,0},2,7},
+      {{-1,-3,0,0},4,9}, {{-1,-3,0,0},4,9}, {{-1,-3,0,0},3,8}, {{-1,-3,0,0},3,8},
+      {{-1,-3,1,0},3,10}, {{-1,-3,-1,0},3,10}, {{-1,-3,0,0},2,7}, {{-1,-3,0,0},2,7},
+      {{2,0,0,0},4,7}, {{2,0,0,0},4,7}, {{2,0,0,0},4,7}, {{2,0,0,0},4,7},
+      {{2,0,0,0},4,7}, {{2,0,0,0},4,7}, {{2,0,0,0},4,7}, {{2,0,0,0},4,7},
+      {{2,0,0,1},4,9}, {{2,0,0,1},4,9}, {{2,0,0,-1},4,9}, {{2,0,0,-1},4,9},
+      {{2,0,0,2},4,10}, {{2,0,0,-2},4,10}, {{2,0,0,3},4,10}, {{2,0,0,-3},4,10},
+      {{2,0,1,0},4,9}, {{2,0,1,0},4,9}, {{2,0,1,0},3,8}, {{2,0,1,0},3,8},
+      {{2,0,-1,0},4,9}, {{2,0,-1,0},4,9}, {{2,0,-1,0},3,8}, {{2,0,-1,0},3,8},
+      {{2,0,2,0},4,10}, {{2,0,2,0},3,9}, {{2,0,-2,0},4,10}, {{2,0,-2,0},3,9},
+      {{2,0,3,0},4,10}, {{2,0,3,0},3,9}, {{2,0,-3,0},4,10}, {{2,0,-3,0},3,9},
+      {{2,1,0,0},4,9}, {{2,1,0,0},4,9}, {{2,1,0,0},3,8}, {{2,1,0,0},3,8},
+      {{2,1,1,0},3,10}, {{2,1,-1,0},3,10}, {{2,1,0,0},2,7}, {{2,1,0,0},2,7},
+      {{2,-1,0,0},4,9}, {{2,-1,0,0},4,9}, {{2,-1,0,0},3,8}, {{2,-1,0,0},3,8},
+      {{2,-1,1,0},3,10}, {{2,-1,-1,0},3,10}, {{2,-1,0,0},2,7}, {{2,-1,0,0},2,7},
+      {{2,2,0,0},4,10}, {{2,2,0,0},3,9}, {{2,2,0,0},2,8}, {{2,2,0,0},2,8},
+      {{2,-2,0,0},4,10}, {{2,-2,0,0},3,9}, {{2,-2,0,0},2,8}, {{2,-2,0,0},2,8},
+      {{2,3,0,0},4,10}, {{2,3,0,0},3,9}, {{2,3,0,0},2,8}, {{2,3,0,0},2,8},
+      {{2,-3,0,0},4,10}, {{2,-3,0,0},3,9}, {{2,-3,0,0},2,8}, {{2,-3,0,0},2,8},
+      {{-2,0,0,0},4,7}, {{-2,0,0,0},4,7}, {{-2,0,0,0},4,7}, {{-2,0,0,0},4,7},
+      {{-2,0,0,0},4,7}, {{-2,0,0,0},4,7}, {{-2,0,0,0},4,7}, {{-2,0,0,0},4,7},
+      {{-2,0,0,1},4,9}, {{-2,0,0,1},4,9}, {{-2,0,0,-1},4,9}, {{-2,0,0,-1},4,9},
+      {{-2,0,0,2},4,10}, {{-2,0,0,-2},4,10}, {{-2,0,0,3},4,10}, {{-2,0,0,-3},4,10},
+      {{-2,0,1,0},4,9}, {{-2,0,1,0},4,9}, {{-2,0,1,0},3,8}, {{-2,0,1,0},3,8},
+      {{-2,0,-1,0},4,9}, {{-2,0,-1,0},4,9}, {{-2,0,-1,0},3,8}, {{-2,0,-1,0},3,8},
+      {{-2,0,2,0},4,10}, {{-2,0,2,0},3,9}, {{-2,0,-2,0},4,10}, {{-2,0,-2,0},3,9},
+      {{-2,0,3,0},4,10}, {{-2,0,3,0},3,9}, {{-2,0,-3,0},4,10}, {{-2,0,-3,0},3,9},
+      {{-2,1,0,0},4,9}, {{-2,1,0,0},4,9}, {{-2,1,0,0},3,8}, {{-2,1,0,0},3,8},
+      {{-2,1,1,0},3,10}, {{-2,1,-1,0},3,10}, {{-2,1,0,0},2,7}, {{-2,1,0,0},2,7},
+      {{-2,-1,0,0},4,9}, {{-2,-1,0,0},4,9}, {{-2,-1,0,0},3,8}, {{-2,-1,0,0},3,8},
+      {{-2,-1,1,0},3,10}, {{-2,-1,-1,0},3,10}, {{-2,-1,0,0},2,7}, {{-2,-1,0,0},2,7},
+      {{-2,2,0,0},4,10}, {{-2,2,0,0},3,9}, {{-2,2,0,0},2,8}, {{-2,2,0,0},2,8},
+      {{-2,-2,0,0},4,10}, {{-2,-2,0,0},3,9}, {{-2,-2,0,0},2,8}, {{-2,-2,0,0},2,8},
+      {{-2,3,0,0},4,10}, {{-2,3,0,0},3,9}, {{-2,3,0,0},2,8}, {{-2,3,0,0},2,8},
+      {{-2,-3,0,0},4,10}, {{-2,-3,0,0},3,9}, {{-2,-3,0,0},2,8}, {{-2,-3,0,0},2,8},
+      {{3,0,0,0},4,7}, {{3,0,0,0},4,7}, {{3,0,0,0},4,7}, {{3,0,0,0},4,7},
+      {{3,0,0,0},4,7}, {{3,0,0,0},4,7}, {{3,0,0,0},4,7}, {{3,0,0,0},4,7},
+      {{3,0,0,1},4,9}, {{3,0,0,1},4,9}, {{3,0,0,-1},4,9}, {{3,0,0,-1},4,9},
+      {{3,0,0,2},4,10}, {{3,0,0,-2},4,10}, {{3,0,0,3},4,10}, {{3,0,0,-3},4,10},
+      {{3,0,1,0},4,9}, {{3,0,1,0},4,9}, {{3,0,1,0},3,8}, {{3,0,1,0},3,8},
+      {{3,0,-1,0},4,9}, {{3,0,-1,0},4,9}, {{3,0,-1,0},3,8}, {{3,0,-1,0},3,8},
+      {{3,0,2,0},4,10}, {{3,0,2,0},3,9}, {{3,0,-2,0},4,10}, {{3,0,-2,0},3,9},
+      {{3,0,3,0},4,10}, {{3,0,3,0},3,9}, {{3,0,-3,0},4,10}, {{3,0,-3,0},3,9},
+      {{3,1,0,0},4,9}, {{3,1,0,0},4,9}, {{3,1,0,0},3,8}, {{3,1,0,0},3,8},
+      {{3,1,1,0},3,10}, {{3,1,-1,0},3,10}, {{3,1,0,0},2,7}, {{3,1,0,0},2,7},
+      {{3,-1,0,0},4,9}, {{3,-1,0,0},4,9}, {{3,-1,0,0},3,8}, {{3,-1,0,0},3,8},
+      {{3,-1,1,0},3,10}, {{3,-1,-1,0},3,10}, {{3,-1,0,0},2,7}, {{3,-1,0,0},2,7},
+      {{3,2,0,0},4,10}, {{3,2,0,0},3,9}, {{3,2,0,0},2,8}, {{3,2,0,0},2,8},
+      {{3,-2,0,0},4,10}, {{3,-2,0,0},3,9}, {{3,-2,0,0},2,8}, {{3,-2,0,0},2,8},
+      {{3,3,0,0},4,10}, {{3,3,0,0},3,9}, {{3,3,0,0},2,8}, {{3,3,0,0},2,8},
+      {{3,-3,0,0},4,10}, {{3,-3,0,0},3,9}, {{3,-3,0,0},2,8}, {{3,-3,0,0},2,8},
+      {{-3,0,0,0},4,7}, {{-3,0,0,0},4,7}, {{-3,0,0,0},4,7}, {{-3,0,0,0},4,7},
+      {{-3,0,0,0},4,7}, {{-3,0,0,0},4,7}, {{-3,0,0,0},4,7}, {{-3,0,0,0},4,7},
+      {{-3,0,0,1},4,9}, {{-3,0,0,1},4,9}, {{-3,0,0,-1},4,9}, {{-3,0,0,-1},4,9},
+      {{-3,0,0,2},4,10}, {{-3,0,0,-2},4,10}, {{-3,0,0,3},4,10}, {{-3,0,0,-3},4,10},
+      {{-3,0,1,0},4,9}, {{-3,0,1,0},4,9}, {{-3,0,1,0},3,8}, {{-3,0,1,0},3,8},
+      {{-3,0,-1,0},4,9}, {{-3,0,-1,0},4,9}, {{-3,0,-1,0},3,8}, {{-3,0,-1,0},3,8},
+      {{-3,0,2,0},4,10}, {{-3,0,2,0},3,9}, {{-3,0,-2,0},4,10}, {{-3,0,-2,0},3,9},
+      {{-3,0,3,0},4,10}, {{-3,0,3,0},3,9}, {{-3,0,-3,0},4,10}, {{-3,0,-3,0},3,9},
+      {{-3,1,0,0},4,9}, {{-3,1,0,0},4,9}, {{-3,1,0,0},3,8}, {{-3,1,0,0},3,8},
+      {{-3,1,1,0},3,10}, {{-3,1,-1,0},3,10}, {{-3,1,0,0},2,7}, {{-3,1,0,0},2,7},
+      {{-3,-1,0,0},4,9}, {{-3,-1,0,0},4,9}, {{-3,-1,0,0},3,8}, {{-3,-1,0,0},3,8},
+      {{-3,-1,1,0},3,10}, {{-3,-1,-1,0},3,10}, {{-3,-1,0,0},2,7}, {{-3,-1,0,0},2,7},
+      {{-3,2,0,0},4,10}, {{-3,2,0,0},3,9}, {{-3,2,0,0},2,8}, {{-3,2,0,0},2,8},
+      {{-3,-2,0,0},4,10}, {{-3,-2,0,0},3,9}, {{-3,-2,0,0},2,8}, {{-3,-2,0,0},2,8},
+      {{-3,3,0,0},4,10}, {{-3,3,0,0},3,9}, {{-3,3,0,0},2,8}, {{-3,3,0,0},2,8},
+      {{-3,-3,0,0},4,10}, {{-3,-3,0,0},3,9}, {{-3,-3,0,0},2,8}, {{-3,-3,0,0},2,8},
+    },
+    { // Table 4
+      {{0,0,0,0},4,4}, {{0,0,0,0},4,4}, {{0,0,0,0},4,4}, {{0,0,0,0},4,4},
+      {{0,0,0,0},4,4}, {{0,0,0,0},4,4}, {{0,0,0,0},4,4}, {{0,0,0,0},4,4},
+      {{0,0,0,0},4,4}, {{0,0,0,0},4,4}, {{0,0,0,0},4,4}, {{0,0,0,0},4,4},
+      {{0,0,0,0},4,4}, {{0,0,0,0},4,4}, {{0,0,0,0},4,4}, {{0,0,0,0},4,4},
+      {{0,0,0,0},4,4}, {{0,0,0,0},4,4}, {{0,0,0,0},4,4}, {{0,0,0,0},4,4},
+      {{0,0,0,0},4,4}, {{0,0,0,0},4,4}, {{0,0,0,0},4,4}, {{0,0,0,0},4,4},
+      {{0,0,0,0},4,4}, {{0,0,0,0},4,4}, {{0,0,0,0},4,4}, {{0,0,0,0},4,4},
+      {{0,0,0,0},4,4}, {{0,0,0,0},4,4}, {{0,0,0,0},4,4}, {{0,0,0,0},4,4},
+      {{0,0,0,0},4,4}, {{0,0,0,0},4,4}, {{0,0,0,0},4,4}, {{0,0,0,0},4,4},
+      {{0,0,0,0},4,4}, {{0,0,0,0},4,4}, {{0,0,0,0},4,4}, {{0,0,0,0},4,4},
+      {{0,0,0,0},4,4}, {{0,0,0,0},4,4}, {{0,0,0,0},4,4}, {{0,0,0,0},4,4},
+      {{0,0,0,0},4,4}, {{0,0,0,0},4,4}, {{0,0,0,0},4,4}, {{0,0,0,0},4,4},
+      {{0,0,0,0},4,4}, {{0,0,0,0},4,4}, {{0,0,0,0},4,4}, {{0,0,0,0},4,4},
+      {{0,0,0,0},4,4}, {{0,0,0,0},4,4}, {{0,0,0,0},4,4}, {{0,0,0,0},4,4},
+      {{0,0,0,0},4,4}, {{0,0,0,0},4,4}, {{0,0,0,0},4,4}, {{0,0,0,0},4,4},
+      {{0,0,0,0},4,4}, {{0,0,0,0},4,4}, {{0,0,0,0},4,4}, {{0,0,0,0},4,4},
+      {{0,0,0,1},4,6}, {{0,0,0,1},4,6}, {{0,0,0,1},4,6}, {{0,0,0,1},4,6},
+      {{0,0,0,1},4,6}, {{0,0,0,1},4,6}, {{0,0,0,1},4,6}, {{0,0,0,1},4,6},
+      {{0,0,0,1},4,6}, {{0,0,0,1},4,6}, {{0,0,0,1},4,6}, {{0,0,0,1},4,6},
+      {{0,0,0,1},4,6}, {{0,0,0,1},4,6}, {{0,0,0,1},4,6}, {{0,0,0,1},4,6},
+      {{0,0,0,-1},4,6}, {{0,0,0,-1},4,6}, {{0,0,0,-1},4,6}, {{0,0,0,-1},4,6},
+      {{0,0,0,-1},4,6}, {{0,0,0,-1},4,6}, {{0,0,0,-1},4,6}, {{0,0,0,-1},4,6},
+      {{0,0,0,-1},4,6}, {{0,0,0,-1},4,6}, {{0,0,0,-1},4,6}, {{0,0,0,-1},4,6},
+      {{0,0,0,-1},4,6}, {{0,0,0,-1},4,6}, {{0,0,0,-1},4,6}, {{0,0,0,-1},4,6},
+      {{0,0,0,2},4,7}, {{0,0,0,2},4,7}, {{0,0,0,2},4,7}, {{0,0,0,2},4,7},
+      {{0,0,0,2},4,7}, {{0,0,0,2},4,7}, {{0,0,0,2},4,7}, {{0,0,0,2},4,7},
+      {{0,0,0,-2},4,7}, {{0,0,0,-2},4,7}, {{0,0,0,-2},4,7}, {{0,0,0,-2},4,7},
+      {{0,0,0,-2},4,7}, {{0,0,0,-2},4,7}, {{0,0,0,-2},4,7}, {{0,0,0,-2},4,7},
+      {{0,0,0,3},4,8}, {{0,0,0,3},4,8}, {{0,0,0,3},4,8}, {{0,0,0,3},4,8},
+      {{0,0,0,-3},4,8}, {{0,0,0,-3},4,8}, {{0,0,0,-3},4,8}, {{0,0,0,-3},4,8},
+      {{0,0,0,4},4,8}, {{0,0,0,4},4,8}, {{0,0,0,4},4,8}, {{0,0,0,4},4,8},
+      {{0,0,0,-4},4,8}, {{0,0,0,-4},4,8}, {{0,0,0,-4},4,8}, {{0,0,0,-4},4,8},
+      {{0,0,1,0},4,6}, {{0,0,1,0},4,6}, {{0,0,1,0},4,6}, {{0,0,1,0},4,6},
+      {{0,0,1,0},4,6}, {{0,0,1,0},4,6}, {{0,0,1,0},4,6}, {{0,0,1,0},4,6},
+      {{0,0,1,0},4,6}, {{0,0,1,0},4,6}, {{0,0,1,0},4,6}, {{0,0,1,0},4,6},
+      {{0,0,1,0},4,6}, {{0,0,1,0},4,6}, {{0,0,1,0},4,6}, {{0,0,1,0},4,6},
+      {{0,0,1,1},4,8}, {{0,0,1,1},4,8}, {{0,0,1,1},4,8}, {{0,0,1,1},4,8},
+      {{0,0,1,-1},4,8}, {{0,0,1,-1},4,8}, {{0,0,1,-1},4,8}, {{0,0,1,-1},4,8},
+      {{0,0,1,2},4,9}, {{0,0,1,2},4,9}, {{0,0,1,-2},4,9}, {{0,0,1,-2},4,9},
+      {{0,0,1,3},4,10}, {{0,0,1,-3},4,10}, {{0,0,1,4},4,10}, {{0,0,1,-4},4,10},
+      {{0,0,-1,0},4,6}, {{0,0,-1,0},4,6}, {{0,0,-1,0},4,6}, {{0,0,-1,0},4,6},
+      {{0,0,-1,0},4,6}, {{0,0,-1,0},4,6}, {{0,0,-1,0},4,6}, {{0,0,-1,0},4,6},
+      {{0,0,-1,0},4,6}, {{0,0,-1,0},4,6}, {{0,0,-1,0},4,6}, {{0,0,-1,0},4,6},
+      {{0,0,-1,0},4,6}, {{0,0,-1,0},4,6}, {{0,0,-1,0},4,6}, {{0,0,-1,0},4,6},
+      {{0,0,-1,1},4,8}, {{0,0,-1,1},4,8}, {{0,0,-1,1},4,8}, {{0,0,-1,1},4,8},
+      {{0,0,-1,-1},4,8}, {{0,0,-1,-1},4,8}, {{0,0,-1,-1},4,8}, {{0,0,-1,-1},4,8},
+      {{0,0,-1,2},4,9}, {{0,0,-1,2},4,9}, {{0,0,-1,-2},4,9}, {{0,0,-1,-2},4,9},
+      {{0,0,-1,3},4,10}, {{0,0,-1,-3},4,10}, {{0,0,-1,4},4,10}, {{0,0,-1,-4},4,10},
+      {{0,0,2,0},4,7}, {{0,0,2,0},4,7}, {{0,0,2,0},4,7}, {{0,0,2,0},4,7},
+      {{0,0,2,0},4,7}, {{0,0,2,0},4,7}, {{0,0,2,0},4,7}, {{0,0,2,0},4,7},
+      {{0,0,2,1},4,9}, {{0,0,2,1},4,9}, {{0,0,2,-1},4,9}, {{0,0,2,-1},4,9},
+      {{0,0,2,2},4,10}, {{0,0,2,-2},4,10}, {{0,0,2,0},3,6}, {{0,0,2,0},3,6},
+      {{0,0,-2,0},4,7}, {{0,0,-2,0},4,7}, {{0,0,-2,0},4,7}, {{0,0,-2,0},4,7},
+      {{0,0,-2,0},4,7}, {{0,0,-2,0},4,7}, {{0,0,-2,0},4,7}, {{0,0,-2,0},4,7},
+      {{0,0,-2,1},4,9}, {{0,0,-2,1},4,9}, {{0,0,-2,-1},4,9}, {{0,0,-2,-1},4,9},
+      {{0,0,-2,2},4,10}, {{0,0,-2,-2},4,10}, {{0,0,-2,0},3,6}, {{0,0,-2,0},3,6},
+      {{0,0,3,0},4,8}, {{0,0,3,0},4,8}, {{0,0,3,0},4,8}, {{0,0,3,0},4,8},
+      {{0,0,3,1},4,10}, {{0,0,3,-1},4,10}, {{0,0,3,0},3,7}, {{0,0,3,0},3,7},
+      {{0,0,-3,0},4,8}, {{0,0,-3,0},4,8}, {{0,0,-3,0},4,8}, {{0,0,-3,0},4,8},
+      {{0,0,-3,1},4,10}, {{0,0,-3,-1},4,10}, {{0,0,-3,0},3,7}, {{0,0,-3,0},3,7},
+      {{0,0,4,0},4,8}, {{0,0,4,0},4,8}, {{0,0,4,0},4,8}, {{0,0,4,0},4,8},
+      {{0,0,4,1},4,10}, {{0,0,4,-1},4,10}, {{0,0,4,0},3,7}, {{0,0,4,0},3,7},
+      {{0,0,-4,0},4,8}, {{0,0,-4,0},4,8}, {{0,0,-4,0},4,8}, {{0,0,-4,0},4,8},
+      {{0,0,-4,1},4,10}, {{0,0,-4,-1},4,10}, {{0,0,-4,0},3,7}, {{0,0,-4,0},3,7},
+      {{0,1,0,0},4,6}, {{0,1,0,0},4,6}, {{0,1,0,0},4,6}, {{0,1,0,0},4,6},
+      {{0,1,0,0},4,6}, {{0,1,0,0},4,6}, {{0,1,0,0},4,6}, {{0,1,0,0},4,6},
+      {{0,1,0,0},4,6}, {{0,1,0,0},4,6}, {{0,1,0,0},4,6}, {{0,1,0,0},4,6},
+      {{0,1,0,0},4,6}, {{0,1,0,0},4,6}, {{0,1,0,0},4,6}, {{0,1,0,0},4,6},
+      {{0,1,0,1},4,8}, {{0,1,0,1},4,8}, {{0,1,0,1},4,8}, {{0,1,0,1},4,8},
+      {{0,1,0,-1},4,8}, {{0,1,0,-1},4,8}, {{0,1,0,-1},4,8}, {{0,1,0,-1},4,8},
+      {{0,1,0,2},4,9}, {{0,1,0,2},4,9}, {{0,1,0,-2},4,9}, {{0,1,0,-2},4,9},
+      {{0,1,0,3},4,10}, {{0,1,0,-3},4,10}, {{0,1,0,4},4,10}, {{0,1,0,-4},4,10},
+      {{0,1,1,0},4,8}, {{0,1,1,0},4,8}, {{0,1,1,0},4,8}, {{0,1,1,0},4,8},
+      {{0,1,1,1},4,10}, {{0,1,1,-1},4,10}, {{0,1,1,0},3,7}, {{0,1,1,0},3,7},
+      {{0,1,-1,0},4,8}, {{0,1,-1,0},4,8}, {{0,1,-1,0},4,8}, {{0,1,-1,0},4,8},
+      {{0,1,-1,1},4,10}, {{0,1,-1,-1},4,10}, {{0,1,-1,0},3,7}, {{0,1,-1,0},3,7},
+      {{0,1,2,0},4,9}, {{0,1,2,0},4,9}, {{0,1,2,0},3,8}, {{0,1,2,0},3,8},
+      {{0,1,-2,0},4,9}, {{0,1,-2,0},4,9}, {{0,1,-2,0},3,8}, {{0,1,-2,0},3,8},
+      {{0,1,3,0},4,10}, {{0,1,3,0},3,9}, {{0,1,-3,0},4,10}, {{0,1,-3,0},3,9},
+      {{0,1,4,0},4,10}, {{0,1,4,0},3,9}, {{0,1,-4,0},4,10}, {{0,1,-4,0},3,9},
+      {{0,-1,0,0},4,6}, {{0,-1,0,0},4,6}, {{0,-1,0,0},4,6}, {{0,-1,0,0},4,6},
+      {{0,-1,0,0},4,6}, {{0,-1,0,0},4,6}, {{0,-1,0,0},4,6}, {{0,-1,0,0},4,6},
+      {{0,-1,0,0},4,6}, {{0,-1,0,0},4,6}, {{0,-1,0,0},4,6}, {{0,-1,0,0},4,6},
+      {{0,-1,0,0},4,6}, {{0,-1,0,0},4,6}, {{0,-1,0,0},4,6}, {{0,-1,0,0},4,6},
+      {{0,-1,0,1},4,8}, {{0,-1,0,1},4,8}, {{0,-1,0,1},4,8}, {{0,-1,0,1},4,8},
+      {{0,-1,0,-1},4,8}, {{0,-1,0,-1},4,8}, {{0,-1,0,-1},4,8}, {{0,-1,0,-1},4,8},
+      {{0,-1,0,2},4,9}, {{0,-1,0,2},4,9}, {{0,-1,0,-2},4,9}, {{0,-1,0,-2},4,9},
+      {{0,-1,0,3},4,10}, {{0,-1,0,-3},4,10}, {{0,-1,0,4},4,10}, {{0,-1,0,-4},4,10},
+      {{0,-1,1,0},4,8}, {{0,-1,1,0},4,8}, {{0,-1,1,0},4,8}, {{0,-1,1,0},4,8},
+      {{0,-1,1,1},4,10}, {{0,-1,1,-1},4,10}, {{0,-1,1,0},3,7}, {{0,-1,1,0},3,7},
+      {{0,-1,-1,0},4,8}, {{0,-1,-1,0},4,8}, {{0,-1,-1,0},4,8}, {{0,-1,-1,0},4,8},
+      {{0,-1,-1,1},4,10}, {{0,-1,-1,-1},4,10}, {{0,-1,-1,0},3,7}, {{0,-1,-1,0},3,7},
+      {{0,-1,2,0},4,9}, {{0,-1,2,0},4,9}, {{0,-1,2,0},3,8}, {{0,-1,2,0},3,8},
+      {{0,-1,-2,0},4,9}, {{0,-1,-2,0},4,9}, {{0,-1,-2,0},3,8}, {{0,-1,-2,0},3,8},
+      {{0,-1,3,0},4,10}, {{0,-1,3,0},3,9}, {{0,-1,-3,0},4,10}, {{0,-1,-3,0},3,9},
+      {{0,-1,4,0},4,10}, {{0,-1,4,0},3,9}, {{0,-1,-4,0},4,10}, {{0,-1,-4,0},3,9},
+      {{0,2,0,0},4,7}, {{0,2,0,0},4,7}, {{0,2,0,0},4,7}, {{0,2,0,0},4,7},
+      {{0,2,0,0},4,7}, {{0,2,0,0},4,7}, {{0,2,0,0},4,7}, {{0,2,0,0},4,7},
+      {{0,2,0,1},4,9}, {{0,2,0,1},4,9}, {{0,2,0,-1},4,9}, {{0,2,0,-1},4,9},
+      {{0,2,0,2},4,10}, {{0,2,0,-2},4,10}, {{0,2,0,0},3,6}, {{0,2,0,0},3,6},
+      {{0,2,1,0},4,9}, {{0,2,1,0},4,9}, {{0,2,1,0},3,8}, {{0,2,1,0},3,8},
+      {{0,2,-1,0},4,9}, {{0,2,-1,0},4,9}, {{0,2,-1,0},3,8}, {{0,2,-1,0},3,8},
+      {{0,2,2,0},4,10}, {{0,2,2,0},3,9}, {{0,2,-2,0},4,10}, {{0,2,-2,0},3,9},
+      {{0,2,3,0},3,10}, {{0,2,-3,0},3,10}, {{0,2,4,0},3,10}, {{0,2,-4,0},3,10},
+      {{0,-2,0,0},4,7}, {{0,-2,0,0},4,7}, {{0,-2,0,0},4,7}, {{0,-2,0,0},4,7},
+      {{0,-2,0,0},4,7}, {{0,-2,0,0},4,7}, {{0,-2,0,0},4,7}, {{0,-2,0,0},4,7},
+      {{0,-2,0,1},4,9}, {{0,-2,0,1},4,9}, {{0,-2,0,-1},4,9}, {{0,-2,0,-1},4,9},
+      {{0,-2,0,2},4,10}, {{0,-2,0,-2},4,10}, {{0,-2,0,0},3,6}, {{0,-2,0,0},3,6},
+      {{0,-2,1,0},4,9}, {{0,-2,1,0},4,9}, {{0,-2,1,0},3,8}, {{0,-2,1,0},3,8},
+      {{0,-2,-1,0},4,9}, {{0,-2,-1,0},4,9}, {{0,-2,-1,0},3,8}, {{0,-2,-1,0},3,8},
+      {{0,-2,2,0},4,10}, {{0,-2,2,0},3,9}, {{0,-2,-2,0},4,10}, {{0,-2,-2,0},3,9},
+      {{0,-2,3,0},3,10}, {{0,-2,-3,0},3,10}, {{0,-2,4,0},3,10}, {{0,-2,-4,0},3,10},
+      {{0,3,0,0},4,8}, {{0,3,0,0},4,8}, {{0,3,0,0},4,8}, {{0,3,0,0},4,8},
+      {{0,3,0,1},4,10}, {{0,3,0,-1},4,10}, {{0,3,0,0},3,7}, {{0,3,0,0},3,7},
+      {{0,3,1,0},4,10}, {{0,3,1,0},3,9}, {{0,3,-1,0},4,10}, {{0,3,-1,0},3,9},
+      {{0,3,2,0},3,10}, {{0,3,-2,0},3,10}, {{0,3,0,0},2,6}, {{0,3,0,0},2,6},
+      {{0,-3,0,0},4,8}, {{0,-3,0,0},4,8}, {{0,-3,0,0},4,8}, {{0,-3,0,0},4,8},
+      {{0,-3,0,1},4,10}, {{0,-3,0,-1},4,10}, {{0,-3,0,0},3,7}, {{0,-3,0,0},3,7},
+      {{0,-3,1,0},4,10}, {{0,-3,1,0},3,9}, {{0,-3,-1,0},4,10}, {{0,-3,-1,0},3,9},
+      {{0,-3,2,0},3,10}, {{0,-3,-2,0},3,10}, {{0,-3,0,0},2,6}, {{0,-3,0,0},2,6},
+      {{0,4,0,0},4,8}, {{0,4,0,0},4,8}, {{0,4,0,0},4,8}, {{0,4,0,0},4,8},
+      {{0,4,0,1},4,10}, {{0,4,0,-1},4,10}, {{0,4,0,0},3,7}, {{0,4,0,0},3,7},
+      {{0,4,1,0},4,10}, {{0,4,1,0},3,9}, {{0,4,-1,0},4,10}, {{0,4,-1,0},3,9},
+      {{0,4,2,0},3,10}, {{0,4,-2,0},3,10}, {{0,4,0,0},2,6}, {{0,4,0,0},2,6},
+      {{0,-4,0,0},4,8}, {{0,-4,0,0},4,8}, {{0,-4,0,0},4,8}, {{0,-4,0,0},4,8},
+      {{0,-4,0,1},4,10}, {{0,-4,0,-1},4,10}, {{0,-4,0,0},3,7}, {{0,-4,0,0},3,7},
+      {{0,-4,1,0},4,10}, {{0,-4,1,0},3,9}, {{0,-4,-1,0},4,10}, {{0,-4,-1,0},3,9},
+      {{0,-4,2,0},3,10}, {{0,-4,-2,0},3,10}, {{0,-4,0,0},2,6}, {{0,-4,0,0},2,6},
+      {{1,0,0,0},4,6}, {{1,0,0,0},4,6}, {{1,0,0,0},4,6}, {{1,0,0,0},4,6},
+      {{1,0,0,0},4,6}, {{1,0,0,0},4,6}, {{1,0,0,0},4,6}, {{1,0,0,0},4,6},
+      {{1,0,0,0},4,6}, {{1,0,0,0},4,6}, {{1,0,0,0},4,6}, {{1,0,0,0},4,6},
+      {{1,0,0,0},4,6}, {{1,0,0,0},4,6}, {{1,0,0,0},4,6}, {{1,0,0,0},4,6},
+      {{1,0,0,1},4,8}, {{1,0,0,1},4,8}, {{1,0,0,1},4,8}, {{1,0,0,1},4,8},
+      {{1,0,0,-1},4,8}, {{1,0,0,-1},4,8}, {{1,0,0,-1},4,8}, {{1,0,0,-1},4,8},
+      {{1,0,0,2},4,9}, {{1,0,0,2},4,9}, {{1,0,0,-2},4,9}, {{1,0,0,-2},4,9},
+      {{1,0,0,3},4,10}, {{1,0,0,-3},4,10}, {{1,0,0,4},4,10}, {{1,0,0,-4},4,10},
+      {{1,0,1,0},4,8}, {{1,0,1,0},4,8}, {{1,0,1,0},4,8}, {{1,0,1,0},4,8},
+      {{1,0,1,1},4,10}, {{1,0,1,-1},4,10}, {{1,0,1,0},3,7}, {{1,0,1,0},3,7},
+      {{1,0,-1,0},4,8}, {{1,0,-1,0},4,8}, {{1,0,-1,0},4,8}, {{1,0,-1,0},4,8},
+      {{1,0,-1,1},4,10}, {{1,0,-1,-1},4,10}, {{1,0,-1,0},3,7}, {{1,0,-1,0},3,7},
+      {{1,0,2,0},4,9}, {{1,0,2,0},4,9}, {{1,0,2,0},3,8}, {{1,0,2,0},3,8},
+      {{1,0,-2,0},4,9}, {{1,0,-2,0},4,9}, {{1,0,-2,0},3,8}, {{1,0,-2,0},3,8},
+      {{1,0,3,0},4,10}, {{1,0,3,0},3,9}, {{1,0,-3,0},4,10}, {{1,0,-3,0},3,9},
+      {{1,0,4,0},4,10}, {{1,0,4,0},3,9}, {{1,0,-4,0},4,10}, {{1,0,-4,0},3,9},
+      {{1,1,0,0},4,8}, {{1,1,0,0},4,8}, {{1,1,0,0},4,8}, {{1,1,0,0},4,8},
+      {{1,1,0,1},4,10}, {{1,1,0,-1},4,10}, {{1,1,0,0},3,7}, {{1,1,0,0},3,7},
+      {{1,1,1,0},4,10}, {{1,1,1,0},3,9}, {{1,1,-1,0},4,10}, {{1,1,-1,0},3,9},
+      {{1,1,2,0},3,10}, {{1,1,-2,0},3,10}, {{1,1,0,0},2,6}, {{1,1,0,0},2,6},
+      {{1,-1,0,0},4,8}, {{1,-1,0,0},4,8}, {{1,-1,0,0},4,8}, {{1,-1,0,0},4,8},
+      {{1,-1,0,1},4,10}, {{1,-1,0,-1},4,10}, {{1,-1,0,0},3,7}, {{1,-1,0,0},3,7},
+      {{1,-1,1,0},4,10}, {{1,-1,1,0},3,9}, {{1,-1,-1,0},4,10}, {{1,-1,-1,0},3,9},
+      {{1,-1,2,0},3,10}, {{1,-1,-2,0},3,10}, {{1,-1,0,0},2,6}, {{1,-1,0,0},2,6},
+      {{1,2,0,0},4,9}, {{1,2,0,0},4,9}, {{1,2,0,0},3,8}, {{1,2,0,0},3,8},
+      {{1,2,1,0},3,10}, {{1,2,-1,0},3,10}, {{1,2,0,0},2,7}, {{1,2,0,0},2,7},
+      {{1,-2,0,0},4,9}, {{1,-2,0,0},4,9}, {{1,-2,0,0},3,8}, {{1,-2,0,0},3,8},
+      {{1,-2,1,0},3,10}, {{1,-2,-1,0},3,10}, {{1,-2,0,0},2,7}, {{1,-2,0,0},2,7},
+      {{1,3,0,0},4,10}, {{1,3,0,0},3,9}, {{1,3,0,0},2,8}, {{1,3,0,0},2,8},
+      {{1,-3,0,0},4,10}, {{1,-3,0,0},3,9}, {{1,-3,0,0},2,8}, {{1,-3,0,0},2,8},
+      {{1,4,0,0},4,10}, {{1,4,0,0},3,9}, {{1,4,0,0},2,8}, {{1,4,0,0},2,8},
+      {{1,-4,0,0},4,10}, {{1,-4,0,0},3,9}, {{1,-4,0,0},2,8}, {{1,-4,0,0},2,8},
+      {{-1,0,0,0},4,6}, {{-1,0,0,0},4,6}, {{-1,0,0,0},4,6}, {{-1,0,0,0},4,6},
+      {{-1,0,0,0},4,6}, {{-1,0,0,0},4,6}, {{-1,0,0,0},4,6}, {{-1,0,0,0},4,6},
+      {{-1,0,0,0},4,6}, {{-1,0,0,0},4,6}, {{-1,0,0,0},4,6}, {{-1,0,0,0},4,6},
+      {{-1,0,0,0},4,6}, {{-1,0,0,0},4,6}, {{-1,0,0,0},4,6}, {{-1,0,0,0},4,6},
+      {{-1,0,0,1},4,8}, {{-1,0,0,1},4,8}, {{-1,0,0,1},4,8}, {{-1,0,0,1},4,8},
+      {{-1,0,0,-1},4,8}, {{-1,0,0,-1},4,8}, {{-1,0,0,-1},4,8}, {{-1,0,0,-1},4,8},
+      {{-1,0,0,2},4,9}, {{-1,0,0,2},4,9}, {{-1,0,0,-2},4,9}, {{-1,0,0,-2},4,9},
+      {{-1,0,0,3},4,10}, {{-1,0,0,-3},4,10}, {{-1,0,0,4},4,10}, {{-1,0,0,-4},4,10},
+      {{-1,0,1,0},4,8}, {{-1,0,1,0},4,8}, {{-1,0,1,0},4,8}, {{-1,0,1,0},4,8},
+      {{-1,0,1,1},4,10}, {{-1,0,1,-1},4,10}, {{-1,0,1,0},3,7}, {{-1,0,1,0},3,7},
+      {{-1,0,-1,0},4,8}, {{-1,0,-1,0},4,8}, {{-1,0,-1,0},4,8}, {{-1,0,-1,0},4,8},
+      {{-1,0,-1,1},4,10}, {{-1,0,-1,-1},4,10}, {{-1,0,-1,0},3,7}, {{-1,0,-1,0},3,7},
+      {{-1,0,2,0},4,9}, {{-1,0,2,0},4,9}, {{-1,0,2,0},3,8}, {{-1,0,2,0},3,8},
+      {{-1,0,-2,0},4,9}, {{-1,0,-2,0},4,9}, {{-1,0,-2,0},3,8}, {{-1,0,-2,0},3,8},
+      {{-1,0,3,0},4,10}, {{-1,0,3,0},3,9}, {{-1,0,-3,0},4,10}, {{-1,0,-3,0},3,9},
+      {{-1,0,4,0},4,10}, {{-1,0,4,0},3,9}, {{-1,0,-4,0},4,10}, {{-1,0,-4,0},3,9},
+      {{-1,1,0,0},4,8}, {{-1,1,0,0},4,8}, {{-1,1,0,0},4,8}, {{-1,1,0,0},4,8},
+      {{-1,1,0,1},4,10}, {{-1,1,0,-1},4,10}, {{-1,1,0,0},3,7}, {{-1,1,0,0},3,7},
+      {{-1,1,1,0},4,10}, {{-1,1,1,0},3,9}, {{-1,1,-1,0},4,10}, {{-1,1,-1,0},3,9},
+      {{-1,1,2,0},3,10}, {{-1,1,-2,0},3,10}, {{-1,1,0,0},2,6}, {{-1,1,0,0},2,6},
+      {{-1,-1,0,0},4,8}, {{-1,-1,0,0},4,8}, {{-1,-1,0,0},4,8}, {{-1,-1,0,0},4,8},
+      {{-1,-1,0,1},4,10}, {{-1,-1,0,-1},4,10}, {{-1,-1,0,0},3,7}, {{-1,-1,0,0},3,7},
+      {{-1,-1,1,0},4,10}, {{-1,-1,1,0},3,9}, {{-1,-1,-1,0},4,10}, {{-1,-1,-1,0},3,9},
+      {{-1,-1,2,0},3,10}, {{-1,-1,-2,0},3,10}, {{-1,-1,0,0},2,6}, {{-1,-1,0,0},2,6},
+      {{-1,2,0,0},4,9}, {{-1,2,0,0},4,9}, {{-1,2,0,0},3,8}, {{-1,2,0,0},3,8},
+      {{-1,2,1,0},3,10}, {{-1,2,-1,0},3,10}, {{-1,2,0,0},2,7}, {{-1,2,0,0},2,7},
+      {{-1,-2,0,0},4,9}, {{-1,-2,0,0},4,9}, {{-1,-2,0,0},3,8}, {{-1,-2,0,0},3,8},
+      {{-1,-2,1,0},3,10}, {{-1,-2,-1,0},3,10}, {{-1,-2,0,0},2,7}, {{-1,-2,0,0},2,7},
+      {{-1,3,0,0},4,10}, {{-1,3,0,0},3,9}, {{-1,3,0,0},2,8}, {{-1,3,0,0},2,8},
+      {{-1,-3,0,0},4,10}, {{-1,-3,0,0},3,9}, {{-1,-3,0,0},2,8}, {{-1,-3,0,0},2,8},
+      {{-1,4,0,0},4,10}, {{-1,4,0,0},3,9}, {{-1,4,0,0},2,8}, {{-1,4,0,0},2,8},
+      {{-1,-4,0,0},4,10}, {{-1,-4,0,0},3,9}, {{-1,-4,0,0},2,8}, {{-1,-4,0,0},2,8},
+      {{2,0,0,0},4,7}, {{2,0,0,0},4,7}, {{2,0,0,0},4,7}, {{2,0,0,0},4,7},
+      {{2,0,0,0},4,7}, {{2,0,0,0},4,7}, {{2,0,0,0},4,7}, {{2,0,0,0},4,7},
+      {{2,0,0,1},4,9}, {{2,0,0,1},4,9}, {{2,0,0,-1},4,9}, {{2,0,0,-1},4,9},
+      {{2,0,0,2},4,10}, {{2,0,0,-2},4,10}, {{2,0,0,0},3,6}, {{2,0,0,0},3,6},
+      {{2,0,1,0},4,9}, {{2,0,1,0},4,9}, {{2,0,1,0},3,8}, {{2,0,1,0},3,8},
+      {{2,0,-1,0},4,9}, {{2,0,-1,0},4,9}, {{2,0,-1,0},3,8}, {{2,0,-1,0},3,8},
+      {{2,0,2,0},4,10}, {{2,0,2,0},3,9}, {{2,0,-2,0},4,10}, {{2,0,-2,0},3,9},
+      {{2,0,3,0},3,10}, {{2,0,-3,0},3,10}, {{2,0,4,0},3,10}, {{2,0,-4,0},3,10},
+      {{2,1,0,0},4,9}, {{2,1,0,0},4,9}, {{2,1,0,0},3,8}, {{2,1,0,0},3,8},
+      {{2,1,1,0},3,10}, {{2,1,-1,0},3,10}, {{2,1,0,0},2,7}, {{2,1,0,0},2,7},
+      {{2,-1,0,0},4,9}, {{2,-1,0,0},4,9}, {{2,-1,0,0},3,8}, {{2,-1,0,0},3,8},
+      {{2,-1,1,0},3,10}, {{2,-1,-1,0},3,10}, {{2,-1,0,0},2,7}, {{2,-1,0,0},2,7},
+      {{2,2,0,0},4,10}, {{2,2,0,0},3,9}, {{2,2,0,0},2,8}, {{2,2,0,0},2,8},
+      {{2,-2,0,0},4,10}, {{2,-2,0,0},3,9}, {{2,-2,0,0},2,8}, {{2,-2,0,0},2,8},
+      {{2,3,0,0},3,10}, {{2,3,0,0},2,9}, {{2,-3,0,0},3,10}, {{2,-3,0,0},2,9},
+      {{2,4,0,0},3,10}, {{2,4,0,0},2,9}, {{2,-4,0,0},3,10}, {{2,-4,0,0},2,9},
+      {{-2,0,0,0},4,7}, {{-2,0,0,0},4,7}, {{-2,0,0,0},4,7}, {{-2,0,0,0},4,7},
+      {{-2,0,0,0},4,7}, {{-2,0,0,0},4,7}, {{-2,0,0,0},4,7}, {{-2,0,0,0},4,7},
+      {{-2,0,0,1},4,9}, {{-2,0,0,1},4,9}, {{-2,0,0,-1},4,9}, {{-2,0,0,-1},4,9},
+      {{-2,0,0,2},4,10}, {{-2,0,0,-2},4,10}, {{-2,0,0,0},3,6}, {{-2,0,0,0},3,6},
+      {{-2,0,1,0},4,9}, {{-2,0,1,0},4,9}, {{-2,0,1,0},3,8}, {{-2,0,1,0},3,8},
+      {{-2,0,-1,0},4,9}, {{-2,0,-1,0},4,9}, {{-2,0,-1,0},3,8}, {{-2,0,-1,0},3,8},
+      {{-2,0,2,0},4,10}, {{-2,0,2,0},3,9}, {{-2,0,-2,0},4,10}, {{-2,0,-2,0},3,9},
+      {{-2,0,3,0},3,10}, {{-2,0,-3,0},3,10}, {{-2,0,4,0},3,10}, {{-2,0,-4,0},3,10},
+      {{-2,1,0,0},4,9}, {{-2,1,0,0},4,9}, {{-2,1,0,0},3,8}, {{-2,1,0,0},3,8},
+      {{-2,1,1,0},3,10}, {{-2,1,-1,0},3,10}, {{-2,1,0,0},2,7}, {{-2,1,0,0},2,7},
+      {{-2,-1,0,0},4,9}, {{-2,-1,0,0},4,9}, {{-2,-1,0,0},3,8}, {{-2,-1,0,0},3,8},
+      {{-2,-1,1,0},3,10}, {{-2,-1,-1,0},3,10}, {{-2,-1,0,0},2,7}, {{-2,-1,0,0},2,7},
+      {{-2,2,0,0},4,10}, {{-2,2,0,0},3,9}, {{-2,2,0,0},2,8}, {{-2,2,0,0},2,8},
+      {{-2,-2,0,0},4,10}, {{-2,-2,0,0},3,9}, {{-2,-2,0,0},2,8}, {{-2,-2,0,0},2,8},
+      {{-2,3,0,0},3,10}, {{-2,3,0,0},2,9}, {{-2,-3,0,0},3,10}, {{-2,-3,0,0},2,9},
+      {{-2,4,0,0},3,10}, {{-2,4,0,0},2,9}, {{-2,-4,0,0},3,10}, {{-2,-4,0,0},2,9},
+      {{3,0,0,0},4,8}, {{3,0,0,0},4,8}, {{3,0,0,0},4,8}, {{3,0,0,0},4,8},
+      {{3,0,0,1},4,10}, {{3,0,0,-1},4,10}, {{3,0,0,0},3,7}, {{3,0,0,0},3,7},
+      {{3,0,1,0},4,10}, {{3,0,1,0},3,9}, {{3,0,-1,0},4,10}, {{3,0,-1,0},3,9},
+      {{3,0,2,0},3,10}, {{3,0,-2,0},3,10}, {{3,0,0,0},2,6}, {{3,0,0,0},2,6},
+      {{3,1,0,0},4,10}, {{3,1,0,0},3,9}, {{3,1,0,0},2,8}, {{3,1,0,0},2,8},
+      {{3,-1,0,0},4,10}, {{3,-1,0,0},3,9}, {{3,-1,0,0},2,8}, {{3,-1,0,0},2,8},
+      {{3,2,0,0},3,10}, {{3,2,0,0},2,9}, {{3,-2,0,0},3,10}, {{3,-2,0,0},2,9},
+      {{3,3,0,0},2,10}, {{3,-3,0,0},2,10}, {{3,4,0,0},2,10}, {{3,-4,0,0},2,10},
+      {{-3,0,0,0},4,8}, {{-3,0,0,0},4,8}, {{-3,0,0,0},4,8}, {{-3,0,0,0},4,8},
+      {{-3,0,0,1},4,10}, {{-3,0,0,-1},4,10}, {{-3,0,0,0},3,7}, {{-3,0,0,0},3,7},
+      {{-3,0,1,0},4,10}, {{-3,0,1,0},3,9}, {{-3,0,-1,0},4,10}, {{-3,0,-1,0},3,9},
+      {{-3,0,2,0},3,10}, {{-3,0,-2,0},3,10}, {{-3,0,0,0},2,6}, {{-3,0,0,0},2,6},
+      {{-3,1,0,0},4,10}, {{-3,1,0,0},3,9}, {{-3,1,0,0},2,8}, {{-3,1,0,0},2,8},
+      {{-3,-1,0,0},4,10}, {{-3,-1,0,0},3,9}, {{-3,-1,0,0},2,8}, {{-3,-1,0,0},2,8},
+      {{-3,2,0,0},3,10}, {{-3,2,0,0},2,9}, {{-3,-2,0,0},3,10}, {{-3,-2,0,0},2,9},
+      {{-3,3,0,0},2,10}, {{-3,-3,0,0},2,10}, {{-3,4,0,0},2,10}, {{-3,-4,0,0},2,10},
+      {{4,0,0,0},4,8}, {{4,0,0,0},4,8}, {{4,0,0,0},4,8}, {{4,0,0,0},4,8},
+      {{4,0,0,1},4,10}, {{4,0,0,-1},4,10}, {{4,0,0,0},3,7}, {{4,0,0,0},3,7},
+      {{4,0,1,0},4,10}, {{4,0,1,0},3,9}, {{4,0,-1,0},4,10}, {{4,0,-1,0},3,9},
+      {{4,0,2,0},3,10}, {{4,0,-2,0},3,10}, {{4,0,0,0},2,6}, {{4,0,0,0},2,6},
+      {{4,1,0,0},4,10}, {{4,1,0,0},3,9}, {{4,1,0,0},2,8}, {{4,1,0,0},2,8},
+      {{4,-1,0,0},4,10}, {{4,-1,0,0},3,9}, {{4,-1,0,0},2,8}, {{4,-1,0,0},2,8},
+      {{4,2,0,0},3,10}, {{4,2,0,0},2,9}, {{4,-2,0,0},3,10}, {{4,-2,0,0},2,9},
+      {{4,3,0,0},2,10}, {{4,-3,0,0},2,10}, {{4,4,0,0},2,10}, {{4,-4,0,0},2,10},
+      {{-4,0,0,0},4,8}, {{-4,0,0,0},4,8}, {{-4,0,0,0},4,8}, {{-4,0,0,0},4,8},
+      {{-4,0,0,1},4,10}, {{-4,0,0,-1},4,10}, {{-4,0,0,0},3,7}, {{-4,0,0,0},3,7},
+      {{-4,0,1,0},4,10}, {{-4,0,1,0},3,9}, {{-4,0,-1,0},4,10}, {{-4,0,-1,0},3,9},
+      {{-4,0,2,0},3,10}, {{-4,0,-2,0},3,10}, {{-4,0,0,0},2,6}, {{-4,0,0,0},2,6},
+      {{-4,1,0,0},4,10}, {{-4,1,0,0},3,9}, {{-4,1,0,0},2,8}, {{-4,1,0,0},2,8},
+      {{-4,-1,0,0},4,10}, {{-4,-1,0,0},3,9}, {{-4,-1,0,0},2,8}, {{-4,-1,0,0},2,8},
+      {{-4,2,0,0},3,10}, {{-4,2,0,0},2,9}, {{-4,-2,0,0},3,10}, {{-4,-2,0,0},2,9},
+      {{-4,3,0,0},2,10}, {{-4,-3,0,0},2,10}, {{-4,4,0,0},2,10}, {{-4,-4,0,0},2,10},
+    },
+  };
+
+} // namespace Atrac3
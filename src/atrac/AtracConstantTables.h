@@ -0,0 +1,39 @@
+#pragma once
+
+#include "AtracConstants.h"
+#include "util/HuffmanTable.h"
+
+// Precomputed ATRAC3 tables, so that constructing Atrac3Constants costs no math or
+// table building. The arrays are defined in the generated AtracConstantTables.cpp;
+// to regenerate it after changing a formula or Huffman table, run `make tables`.
+namespace Atrac3 {
+
+  constexpr int kNumScaleFactors = 64;
+  constexpr int kNumGainCompensationLevels = 16;
+  constexpr int kNumGainCompensationRampSamples = 8;
+  constexpr int kNumGainCompensationRampValues =
+    kNumGainCompensationLevels * kNumGainCompensationLevels * kNumGainCompensationRampSamples;
+
+  // Table 0 is empty, and tables 1 through kNumMultiSymbolHuffmanTables also have
+  // a multi-symbol lookup
+  constexpr int kNumHuffmanTables = 8;
+  constexpr int kNumMultiSymbolHuffmanTables = 4;
+
+  // Atrac3Constants::computeEncodingScalingWindow() and computeDecodingScalingWindow()
+  extern const float kEncodingScalingWindow[kNumSamplesPerSubband];
+  extern const float kDecodingScalingWindow[kNumSamplesPerSubband];
+  // Atrac3Constants::computeScaleFactor()
+  extern const float kScaleFactors[kNumScaleFactors];
+  // Atrac3Constants::computeGainCompensationLevel()
+  extern const float kGainCompensationLevels[kNumGainCompensationLevels];
+  // Atrac3Constants::computeGainCompensationRamp()
+  extern const float kGainCompensationRamps[kNumGainCompensationRampValues];
+
+  // HuffmanTable::getLookup() of each table from Atrac3Constants::buildHuffmanTable()
+  extern const HuffmanTable::LookupEntry
+    kHuffmanLookups[kNumHuffmanTables][1 << HuffmanTable::kMaxCodeBits];
+  // HuffmanTable::getMultiSymbolLookup() of tables 1 through kNumMultiSymbolHuffmanTables
+  extern const HuffmanTable::MultiSymbolEntry
+    kHuffmanMultiSymbolLookups[kNumMultiSymbolHuffmanTables][1 << HuffmanTable::kMultiSymbolBits];
+
+} // namespace Atrac3
@@ -13,12 +13,57 @@ namespace Atrac3 {
 
   constexpr uint8_t kMagicHeaderLP2 = 0x28; // 40 decimal
 
+  // In joint stereo blocks, the second sound unit starts with this 2 bit id instead
+  constexpr uint8_t kJointStereoSecondUnitId = 3;
+
+  // Joint stereo blocks store the second sound unit backwards from the end of the
+  // block, after a run of these sync bytes
+  constexpr uint8_t kJointStereoSyncByte = 0xF8;
+
   // 192 byte Sound Unit block align (mono channel)
   constexpr int kLP2BytesPerSoundUnitChannel = 192;
   // 384 bytes stereo block align (in WAV format chunk)
   constexpr int kLP2BytesPerStereoBlock = 384;
   constexpr int kLP2BytesPerSecond = 16537; // (384*43 + 25 bytes)
 
+  // The ATRAC3 stream modes, which differ in bitrate and stereo coding. Every mode
+  // has a stereo block of fixed size per 1024 samples per channel.
+  enum class StreamModeId : uint8_t {
+    LP2, // 132 kbps, dual mono
+    Kbps105, // 105 kbps, dual mono
+    LP4, // 66 kbps, joint stereo
+    kNumModes
+  };
+
+  // Layout of a stream mode, matched against the WAV format chunk
+  struct StreamMode {
+    StreamModeId id;
+    const char* name;
+    int bytesPerStereoBlock; // WAV block align
+    int bytesPerSecond; // WAV byte rate, (bytesPerStereoBlock * 44100/1024) rounded down
+    bool isJointStereo; // otherwise each channel is an independent sound unit of half the block
+  };
+
+  constexpr StreamMode kStreamModes[static_cast<int>(StreamModeId::kNumModes)] = {
+    { StreamModeId::LP2, "LP2", kLP2BytesPerStereoBlock, kLP2BytesPerSecond, false },
+    { StreamModeId::Kbps105, "105kbps", 304, 13092, false },
+    { StreamModeId::LP4, "LP4", 192, 8268, true },
+  };
+
+  // The largest stereo block of any mode
+  constexpr int kMaxBytesPerStereoBlock = kLP2BytesPerStereoBlock;
+
+  // The mode with the given stereo block size, or null if none
+  const StreamMode* findStreamMode(int bytesPerStereoBlock);
+
+  // Compile-time layout of a stream mode, so that block loops can be specialized per mode
+  template<StreamModeId kId>
+  struct StreamLayout {
+    static constexpr int kBytesPerStereoBlock = kStreamModes[static_cast<int>(kId)].bytesPerStereoBlock;
+    static constexpr int kBytesPerSoundUnit = kBytesPerStereoBlock / 2;
+    static constexpr bool kIsJointStereo = kStreamModes[static_cast<int>(kId)].isJointStereo;
+  };
+
   // The total number of samples generated by rendering a sound unit (the left or
   // right channel within a frame). Note that a sound unit contains 4 subbands with
   // 256 frequencies each. The inverse mDCT generates 512 samples per subband, then
@@ -83,8 +128,24 @@ namespace Atrac3 {
 
   class Atrac3Constants {
    public:
+    // Copies the precomputed tables from AtracConstantTables.cpp
     Atrac3Constants();
 
+    // The process-wide instance, constructed on first use. Constants are never modified
+    // after construction, so parsers and render states on any thread can share it.
+    static const Atrac3Constants& getShared();
+
+    // Reference formulas for the precomputed tables, used to generate and verify them
+    static float computeEncodingScalingWindow(int i);
+    static float computeDecodingScalingWindow(int i);
+    static float computeScaleFactor(int i);
+    static float computeGainCompensationLevel(int i);
+    static float computeGainCompensationRamp(int i);
+
+    // Build a Huffman table at runtime from its code entries, with the same lookups
+    // as the precomputed huffmanTables[tableIndex]
+    void buildHuffmanTable(int tableIndex, HuffmanTable& result) const;
+
     // 512-sample scaling window applied to each QMF subband before MDCT during encoding.
     FloatArray encodingScalingWindow;
 
@@ -124,6 +185,13 @@ namespace Atrac3 {
     // to the next level, then held constant to the next position.
     FloatArray gainCompensationLevelTable;
 
+    // The 8-sample geometric ramps between gain levels, for every pair of
+    // level codes. Each starts at the from level, and steps by an equal ratio
+    // towards the to level, which the sample after the ramp reaches.
+    FloatArray gainCompensationRamps;
+
+    const float* getGainCompensationRamp(int fromLevelCode, int toLevelCode) const;
+
     // The encoding spectral subband ranges for the Block Floating Units (BFUs)
     // have increasing power of 2 sizes. This array defines the starting (and ending)
     // offset for each BFU. After tonal component encoding, each encoded range of the
@@ -184,6 +252,13 @@ namespace Atrac3 {
     // 8 Huffman tables
     std::vector<HuffmanTable> huffmanTables;
 
+    // Joint stereo matrix coefficient pairs for the first and second channel, indexed
+    // by 2 * the matrix selector of a QMF band. When a band's selector changes between
+    // blocks, its first 8 samples interpolate between the pairs of both selectors.
+    FloatArray jointStereoMatrixCoefficients = {
+      0.0f, 2.0f, 2.0f, 2.0f, 0.0f, 0.0f, 1.0f, 1.0f
+    };
+
   };
 
 } // namespace Atrac3
\ No newline at end of file
@@ -1,55 +1,340 @@
 #include "AtracFrame.h"
 #include "util/Logging.h"
+#include <algorithm>
 
 namespace Atrac3Frame {
 
   constexpr const char* kLogCategory = "Atrac3Frame";
 
-  int Parser::parseSoundUnit(IBitstreamReader& bitstream, SoundUnit& result) const {
+  namespace {
+    // Add dequantized values to the spectrum, with the same operations and order as
+    // Atrac3Render::accumulateSpectrum, so both decode paths give identical results
+    void accumulateValues(float* spectrum, int startFrequency,
+        const int* mantissas, int numValues, float scaleFactor) {
+      float* target = spectrum + startFrequency;
+      for (int i=0; i<numValues; ++i) {
+        target[i] += mantissas[i] * scaleFactor;
+      }
+    }
+
+    // The bits of the QMF subbands that a range of frequencies touches. A tonal
+    // component can cross into the next subband.
+    uint8_t getSubbandMask(int startFrequency, int numValues) {
+      if (numValues <= 0) {
+        return 0;
+      }
+      const int first = startFrequency / Atrac3::kNumFrequenciesPerSubband;
+      const int last = (startFrequency + numValues - 1) / Atrac3::kNumFrequenciesPerSubband;
+      return static_cast<uint8_t>((1 << first) | (1 << last));
+    }
+
+    void storeValues(int16_t* target, const int* values, int numValues) {
+      for (int i=0; i<numValues; ++i) {
+        target[i] = static_cast<int16_t>(values[i]);
+      }
+    }
+  }
+
+  constexpr bool CollectStatistics::CodeLengthCounter::kIsCounting;
+
+  template<typename Reader>
+  size_t CollectStatistics::beginSoundUnit(Reader& bitstream) const {
+    ++_statistics->numSoundUnits;
+    return bitstream.getRemainingBits();
+  }
+
+  template<typename Reader>
+  void CollectStatistics::countHeader(Reader& bitstream, int numEncodedQmfBands,
+      size_t& remainingBits) const {
+    ++_statistics->numEncodedQmfBands[numEncodedQmfBands];
+    countSectionBits(bitstream, DecodeStatistics::Header, remainingBits);
+  }
+
+  template<typename Reader>
+  void CollectStatistics::countSection(Reader& bitstream, DecodeStatistics::Section section,
+      const SoundUnit& soundUnit, size_t& remainingBits) const {
+    switch (section) {
+      case DecodeStatistics::GainCompensation:
+        for (const GainDataPointArray& gainArray : soundUnit.gainCompensationBands) {
+          ++_statistics->numGainPoints[gainArray.size()];
+        }
+        break;
+      case DecodeStatistics::TonalComponents:
+        ++_statistics->numTonalGroups[soundUnit.tonalGroups.size()];
+        for (const TonalComponentGroup& group : soundUnit.tonalGroups) {
+          ++_statistics->tonalQuantizationSteps[group.quantizationStepIndex];
+        }
+        break;
+      case DecodeStatistics::SpectralSubbands:
+        for (const SpectralSubband& subband : soundUnit.spectralBands) {
+          ++_statistics->spectralTableSelectors[subband.tableSelector];
+        }
+        break;
+      default:
+        break;
+    }
+    countSectionBits(bitstream, section, remainingBits);
+  }
+
+  template<typename Reader>
+  void CollectStatistics::countSectionBits(Reader& bitstream, DecodeStatistics::Section section,
+      size_t& remainingBits) const {
+    size_t sectionEndBits = bitstream.getRemainingBits();
+    _statistics->sectionBits[section] += remainingBits - sectionEndBits;
+    remainingBits = sectionEndBits;
+  }
+
+  void CollectStatistics::countParsedSoundUnit(size_t remainingBits) const {
+    ++_statistics->numParsedSoundUnits;
+    _statistics->sectionBits[DecodeStatistics::Unused] += remainingBits;
+  }
+
+  template<typename Reader>
+  void CollectStatistics::countEncodedValues(Reader& bitstream, CodingMode codingMode,
+      int tableIndex, int numValues, size_t remainingBits) const {
+    if (tableIndex < 0 || tableIndex >= DecodeStatistics::kNumTables) {
+      return;
+    }
+    DecodeStatistics::TableUsage& usage = (codingMode == CodingMode::ConstantLengthCoded ?
+      _statistics->constantLengthCoded[tableIndex] :
+      _statistics->variableLengthCoded[tableIndex]);
+    ++usage.numArrays;
+    usage.numValues += static_cast<uint64_t>(numValues);
+    usage.numBits += remainingBits - bitstream.getRemainingBits();
+  }
+
+  template<typename Statistics>
+  template<typename Reader>
+  bool BasicParser<Statistics>::parseSoundUnit(Reader& bitstream, SoundUnit& result) const {
+    return parseSoundUnit(bitstream, result, nullptr);
+  }
+
+  template<typename Statistics>
+  template<typename Reader>
+  bool BasicParser<Statistics>::parseSoundUnit(Reader& bitstream, SoundUnit& result, float* spectrum,
+      SoundUnitHeader header) const {
 
     int startByte = bitstream.getByteOffset();
     LogDebug(kLogCategory, "Atrac3 Sound Unit, offset byte %d", startByte);
-    result = SoundUnit(); // clear
-
-// TODO: support LP4
+    result.clear();
+    size_t remainingBits = _statistics.beginSoundUnit(bitstream);
 
     // Verify the header
-    LogDebug(kLogCategory, "verifying 0x%x (%d) magic header", Atrac3::kMagicHeaderLP2, Atrac3::kMagicHeaderLP2);
-    if (bitstream.getBits(6) != Atrac3::kMagicHeaderLP2) {
-      LogError(kLogCategory, "Failed to parse atrac3 sound unit magic header");
-      return false;
+    if (header == SoundUnitHeader::JointStereoSecond) {
+      if (bitstream.getBits(2) != Atrac3::kJointStereoSecondUnitId) {
+        LogError(kLogCategory, "Failed to parse atrac3 joint stereo sound unit id");
+        return false;
+      }
+    } else {
+      LogDebug(kLogCategory, "verifying 0x%x (%d) magic header", Atrac3::kMagicHeaderLP2, Atrac3::kMagicHeaderLP2);
+      if (bitstream.getBits(6) != Atrac3::kMagicHeaderLP2) {
+        LogError(kLogCategory, "Failed to parse atrac3 sound unit magic header");
+        return false;
+      }
     }
 
     // Parse how many of the 4 QMF subbands have encoded data
     int numEncodedQmfBands = bitstream.getBits(2) + 1; // 1 through 4, inclusive
     LogDebug(kLogCategory, "  %d QMF bands encoded", numEncodedQmfBands);
+    _statistics.countHeader(bitstream, numEncodedQmfBands, remainingBits);
 
     // Parse the gain compensation curves for the encoded subbands
     if (!parseGainCompensationSubbands(bitstream, result.gainCompensationBands, numEncodedQmfBands)) {
       LogError(kLogCategory, "Failed to parse gain compensation subbands");
       return false;
     }
+    _statistics.countSection(bitstream, DecodeStatistics::GainCompensation, result, remainingBits);
 
     // Parse the tonal component groups
-    if (!parseTonalComponentGroups(bitstream, numEncodedQmfBands, result.tonalGroups)) {
+    if (!parseTonalComponentGroups(bitstream, numEncodedQmfBands, result, spectrum)) {
       LogError(kLogCategory, "Failed to parse tonal components");
       return false;
     }
+    _statistics.countSection(bitstream, DecodeStatistics::TonalComponents, result, remainingBits);
 
     // Parse spectral subbands
-    if (!parseSpectralSubbands(bitstream, result.spectralBands)) {
+    if (!parseSpectralSubbands(bitstream, result, spectrum)) {
       LogError(kLogCategory, "Failed to parse spectral subbands");
       return false;
     }
     LogDebug(kLogCategory, "  %d spectral subbands", static_cast<uint32_t>(result.spectralBands.size()));
+    _statistics.countSection(bitstream, DecodeStatistics::SpectralSubbands, result, remainingBits);
+
+    // Individual reads don't check bounds, so verify once that the sound unit
+    // didn't claim more data than it holds, which indicates a corrupt unit.
+    if (bitstream.hasOverrun()) {
+      LogError(kLogCategory, "Atrac3 sound unit data overran the end of its bitstream (%d bytes)",
+        static_cast<int>(bitstream.getByteOffset()) - startByte);
+      return false;
+    }
 
     int endByte = bitstream.getByteOffset();
     LogDebug(kLogCategory, "Maybe read atrac3 sound unit (%d bytes)", endByte - startByte);
+    _statistics.countParsedSoundUnit(remainingBits);
     return true;
   }
 
-  bool Parser::parseGainCompensationSubbands(IBitstreamReader& bitstream,
-      std::vector<GainDataPointArray>& subbands, int numEncodedBands) const {
+  template<typename Statistics>
+  template<typename Reader>
+  bool BasicParser<Statistics>::skimSoundUnit(Reader& bitstream, SoundUnitSummary& result,
+      SoundUnitHeader header) const {
+    result = SoundUnitSummary();
+    bool isHeaderValid = (header == SoundUnitHeader::JointStereoSecond ?
+      bitstream.getBits(2) == Atrac3::kJointStereoSecondUnitId :
+      bitstream.getBits(6) == Atrac3::kMagicHeaderLP2);
+    if (!isHeaderValid) {
+      LogError(kLogCategory, "Failed to skim atrac3 sound unit magic header");
+      return false;
+    }
+    int numEncodedQmfBands = bitstream.getBits(2) + 1;
+    result.numEncodedQmfBands = static_cast<uint8_t>(numEncodedQmfBands);
+
+    // Gain data points are 9 bits each
+    for (int i=0; i<numEncodedQmfBands; ++i) {
+      int numGainPoints = bitstream.getBits(3);
+      result.numGainPoints[i] = static_cast<uint8_t>(numGainPoints);
+      bitstream.skipBits(9 * numGainPoints);
+    }
+
+    if (!skipTonalComponentGroups(bitstream, numEncodedQmfBands, result)) {
+      LogError(kLogCategory, "Failed to skim tonal components");
+      return false;
+    }
+
+    int numSubbands = bitstream.getBits(5) + 1;
+    result.numSpectralSubbands = static_cast<uint8_t>(numSubbands);
+    result.spectralCodingMode = static_cast<CodingMode>(bitstream.getBit());
+    for (int i=0; i<numSubbands; ++i) {
+      result.tableSelectors[i] = static_cast<uint8_t>(bitstream.getBits(3));
+    }
+
+    if (bitstream.hasOverrun()) {
+      LogError(kLogCategory, "Atrac3 sound unit metadata overran the end of its bitstream");
+      return false;
+    }
+    return true;
+  }
+
+  template<typename Statistics>
+  int BasicParser<Statistics>::reverseJointStereoSecondUnit(const uint8_t* block, int blockSize, uint8_t* result) {
+    // The sync bytes come first in reverse order, so they are at the end of the block.
+    // At least 4 bytes must be left for the sound unit.
+    int end = blockSize;
+    while (end > 0 && block[end-1] == Atrac3::kJointStereoSyncByte) {
+      --end;
+    }
+    if (end < 4) {
+      return 0;
+    }
+    for (int i=0; i<end; ++i) {
+      result[i] = block[end-1-i];
+    }
+    std::fill(result + end, result + blockSize + kBitstreamGuardBytes, 0);
+    return end;
+  }
+
+  template<typename Statistics>
+  template<typename Reader>
+  void BasicParser<Statistics>::parseJointStereoParameters(Reader& bitstream, JointStereoParameters& result) const {
+    result.swapWeights = static_cast<uint8_t>(bitstream.getBit());
+    result.weightIndex = static_cast<uint8_t>(bitstream.getBits(3));
+    for (uint8_t& selector : result.matrixSelectors) {
+      selector = static_cast<uint8_t>(bitstream.getBits(2));
+    }
+  }
+
+  template<typename Statistics>
+  bool BasicParser<Statistics>::parseJointStereoBlock(const uint8_t* block, int blockSize, SoundUnit* soundUnits,
+      float* const* spectra, JointStereoParameters& parameters, bool* isValid) const {
+    parameters = JointStereoParameters();
+    if (blockSize > Atrac3::kMaxBytesPerStereoBlock) {
+      LogError(kLogCategory, "Joint stereo block of %d bytes is too large", blockSize);
+      soundUnits[0].clear();
+      soundUnits[1].clear();
+      isValid[0] = isValid[1] = false;
+      return false;
+    }
+
+    // The first sound unit may use the whole block
+    UncheckedBitstreamReader bitstream(block, static_cast<size_t>(blockSize));
+    isValid[0] = parseSoundUnit(bitstream, soundUnits[0], spectra ? spectra[0] : nullptr);
+
+    uint8_t reversed[Atrac3::kMaxBytesPerStereoBlock + kBitstreamGuardBytes];
+    int reversedSize = reverseJointStereoSecondUnit(block, blockSize, reversed);
+    if (reversedSize == 0) {
+      LogError(kLogCategory, "Joint stereo block has no second sound unit");
+      soundUnits[1].clear();
+      isValid[1] = false;
+      return false;
+    }
+    bitstream.reset(reversed, static_cast<size_t>(reversedSize));
+    parseJointStereoParameters(bitstream, parameters);
+    isValid[1] = parseSoundUnit(bitstream, soundUnits[1], spectra ? spectra[1] : nullptr,
+      SoundUnitHeader::JointStereoSecond);
+    return isValid[0] && isValid[1];
+  }
+
+  template<typename Statistics>
+  template<typename Reader>
+  bool BasicParser<Statistics>::skipTonalComponentGroups(Reader& bitstream, int numEncodedBands,
+      SoundUnitSummary& result) const {
+    int numGroups = bitstream.getBits(5);
+    result.numTonalGroups = static_cast<uint8_t>(numGroups);
+    if (numGroups == 0) {
+      return true;
+    }
+    CodingMode defaultCodingMode = static_cast<CodingMode>(bitstream.getBits(2));
+    if (defaultCodingMode == CodingMode::Invalid) {
+      return false;
+    }
+
+    // Same layout as parseTonalComponentGroup, without keeping anything but counts
+    int values[kMaxValuesPerTonalComponent];
+    for (int group=0; group<numGroups; ++group) {
+      uint32_t encodedSubbands = bitstream.getBitMask(numEncodedBands);
+      int numValuesPerComponent = bitstream.getBits(3) + 1;
+      int quantizationStepIndex = bitstream.getBits(3);
+      if (quantizationStepIndex <= 1) {
+        return false;
+      }
+      CodingMode codingMode = (defaultCodingMode == CodingMode::PerComponent ?
+        static_cast<CodingMode>(bitstream.getBit()) :
+        defaultCodingMode);
+      int numComponentsInGroup = 0;
+      for (int qmfSubband = 0; qmfSubband < numEncodedBands; ++qmfSubband) {
+        if (((encodedSubbands >> qmfSubband) & 0x1) == 0) {
+          continue;
+        }
+        for (int subbandBin = 0; subbandBin < Atrac3::kNumTonalBinsPerSubband; ++subbandBin) {
+          int numComponentsInBin = bitstream.getBits(3);
+          int tonalBin = (qmfSubband * Atrac3::kNumTonalBinsPerSubband) + subbandBin;
+          for (int i=0; i<numComponentsInBin; ++i) {
+            if (++numComponentsInGroup > Atrac3::kMaxTonalComponentsPerGroup) {
+              return false;
+            }
+            bitstream.skipBits(6); // scale factor index
+            int startFrequency = (tonalBin * Atrac3::kNumFrequenciesPerTonalBin) +
+              bitstream.getBits(6);
+            int numValues = std::min(startFrequency + numValuesPerComponent,
+              Atrac3::kNumFrequenciesInSpectrum) - startFrequency;
+            if (codingMode == CodingMode::ConstantLengthCoded) {
+              bitstream.skipBits(_constants.constantLengthNumBits[quantizationStepIndex] * numValues);
+            } else if (!parseVariableLengthEncodedValues(bitstream,
+                quantizationStepIndex, numValues, values, HuffmanTable::NoCodeLengthCounter())) {
+              return false;
+            }
+          }
+        }
+      }
+      result.numTonalComponents = static_cast<uint16_t>(result.numTonalComponents + numComponentsInGroup);
+    }
+    return true;
+  }
+
+  template<typename Statistics>
+  template<typename Reader>
+  bool BasicParser<Statistics>::parseGainCompensationSubbands(Reader& bitstream,
+      GainCompensationBandArray& subbands, int numEncodedBands) const {
     // Parse the MPEG AAC gain data level/location code pairs, to define
     // the gain curve for a subband. Up to 7 data points allowed per subband.
     subbands.resize(numEncodedBands);
@@ -58,19 +343,20 @@ namespace Atrac3Frame {
       LogDebug(kLogCategory, "  ParseQmfBandGainDataPoints(%d data points)", numGainPoints);
       gainArray.resize(static_cast<size_t>(numGainPoints));
       for (GainDataPoint& g : gainArray) {
-        if (!bitstream.tryGetBits(4, g.levelCode) ||
-            !bitstream.tryGetBits(5, g.locationCode)) {
-            return false;
-        }
+        g.levelCode = static_cast<uint8_t>(bitstream.getBits(4));
+        g.locationCode = static_cast<uint8_t>(bitstream.getBits(5));
       }
     }
     LogDebug(kLogCategory, "  parsed %d gain compensation bands", numEncodedBands);
     return true;
   }
 
-  bool Parser::parseTonalComponentGroups(IBitstreamReader& bitstream,
-      int numEncodedBands, std::vector<TonalComponentGroup>& tonalGroups) const {
+  template<typename Statistics>
+  template<typename Reader>
+  bool BasicParser<Statistics>::parseTonalComponentGroups(Reader& bitstream,
+      int numEncodedBands, SoundUnit& result, float* spectrum) const {
 
+    TonalComponentGroupArray& tonalGroups = result.tonalGroups;
     int numGroups = bitstream.getBits(5);
     tonalGroups.resize(static_cast<size_t>(numGroups));
     LogDebug(kLogCategory, "  parseTonalComponentGroups(%d groups)", numGroups);
@@ -85,7 +371,8 @@ namespace Atrac3Frame {
     }
 
     for (TonalComponentGroup& group : tonalGroups) {
-      if (!parseTonalComponentGroup(bitstream, numEncodedBands, defaultCodingMode, group)) {
+      if (!parseTonalComponentGroup(bitstream, numEncodedBands, defaultCodingMode, group,
+          result, spectrum)) {
         return false;
       }
     }
@@ -93,14 +380,18 @@ namespace Atrac3Frame {
     return true;
   }
 
-  bool Parser::parseTonalComponentGroup(
-        IBitstreamReader& bitstream,
+  template<typename Statistics>
+  template<typename Reader>
+  bool BasicParser<Statistics>::parseTonalComponentGroup(
+        Reader& bitstream,
         int numEncodedQmfBands,
         CodingMode defaultCodingMode,
-        TonalComponentGroup& resultGroup) const {
+        TonalComponentGroup& resultGroup,
+        SoundUnit& result,
+        float* spectrum) const {
     // Of the subbands encoded in this frame, get a bitmask telling which of those
-    // subbands have data in this tonal group.
-    std::vector<bool> encodedSubbands = bitstream.getBitArray(numEncodedQmfBands);
+    // subbands have data in this tonal group (bit N set for subband N).
+    uint32_t encodedSubbands = bitstream.getBitMask(numEncodedQmfBands);
     resultGroup.numValuesPerChildComponent = bitstream.getBits(3)+1; // 1 to 8
     resultGroup.quantizationStepIndex = bitstream.getBits(3);
     if (resultGroup.quantizationStepIndex <= 1) {
@@ -111,43 +402,64 @@ namespace Atrac3Frame {
       defaultCodingMode);
     resultGroup.childComponents.clear();
 
-    // See the Atrac constants header for information on the tonal bin concepts
+    // See the Atrac constants header for information on the tonal bin concepts.
+    // When adding to a spectrum, each component is parsed into the same scratch
+    // component and added right away.
     int totalNumComponents = 0;
+    TonalComponent scratchComponent;
+    int values[kMaxValuesPerTonalComponent];
     for (int qmfSubband = 0; qmfSubband < numEncodedQmfBands; ++qmfSubband) {
-      if (encodedSubbands[qmfSubband]) {
+      if ((encodedSubbands >> qmfSubband) & 0x1) {
         for (int subbandBin = 0; subbandBin < Atrac3::kNumTonalBinsPerSubband; ++subbandBin) {
           int numComponentsInBin = bitstream.getBits(3);
           int tonalBin = (qmfSubband * Atrac3::kNumTonalBinsPerSubband) + subbandBin;
           for (int i=0; i<numComponentsInBin; ++i) {
-            TonalComponent component;
+            if (totalNumComponents == Atrac3::kMaxTonalComponentsPerGroup) {
+              LogDebug(kLogCategory, "Parsed more than maximum %d tonal components",
+                Atrac3::kMaxTonalComponentsPerGroup);
+              return false;
+            }
+            TonalComponent& component = (spectrum ? scratchComponent :
+              resultGroup.childComponents.emplace_back());
             if (!parseTonalComponent(bitstream, resultGroup.codingMode,
               resultGroup.quantizationStepIndex,
               resultGroup.numValuesPerChildComponent, tonalBin,
-              component)) {
+              component, values)) {
               return false;
             }
-            resultGroup.childComponents.emplace_back(std::move(component));
+            result.codedSubbandMask |= getSubbandMask(component.startFrequency, component.numValues);
+            if (spectrum) {
+              accumulateValues(spectrum, component.startFrequency, values,
+                component.numValues, component.scaleFactor);
+            } else {
+              component.mantissaOffset = result.reserveMantissas(component.numValues);
+              if (component.mantissaOffset < 0) {
+                LogDebug(kLogCategory, "Parsed more than maximum %d tonal values",
+                  kMaxTonalValuesPerSoundUnit);
+                return false;
+              }
+              storeValues(result.mantissas.data() + component.mantissaOffset, values,
+                component.numValues);
+            }
             ++totalNumComponents;
           }
         }
       }
     }
-    if (totalNumComponents > Atrac3::kMaxTonalComponentsPerGroup) {
-      LogDebug(kLogCategory, "Parsed total %d tonal components, more than maximum %d",
-        totalNumComponents, Atrac3::kMaxTonalComponentsPerGroup);
-      return false;
-    }
     return true;
   }
 
 
-  bool Parser::parseTonalComponent(
-      IBitstreamReader& bitstream,
+  template<typename Statistics>
+  template<typename Reader>
+  bool BasicParser<Statistics>::parseTonalComponent(
+      Reader& bitstream,
       CodingMode codingMode,
       int quantizationStepIndex,
       int numValuesPerComponent,
       int tonalBin,
-      TonalComponent& result) const {
+      TonalComponent& result,
+      int* values) const {
 
     result.scaleFactorIndex = bitstream.getBits(6);
     result.positionOffset = bitstream.getBits(6); // 0-63, relative to bin start
@@ -162,13 +474,13 @@ namespace Atrac3Frame {
     int endFrequency = std::min(
       result.startFrequency + numValuesPerComponent,
       Atrac3::kNumFrequenciesInSpectrum);
-    int numValues = endFrequency - result.startFrequency;
+    result.numValues = endFrequency - result.startFrequency;
 
     // Read the mantissas
     // Note: (quantizationStepIndex >= 2), from earlier verification
     result.tableSelector = quantizationStepIndex;
     return parseEncodedValues(bitstream, codingMode,
-      result.tableSelector, numValues, result.mantissas);
+      result.tableSelector, result.numValues, values);
   }
 
   /*
@@ -188,14 +500,19 @@ namespace Atrac3Frame {
   */
 
 
-  bool Parser::parseSpectralSubbands(
-        IBitstreamReader& bitstream,
-        std::vector<SpectralSubband>& resultSubbands) const {
+  template<typename Statistics>
+  template<typename Reader>
+  bool BasicParser<Statistics>::parseSpectralSubbands(
+        Reader& bitstream,
+        SoundUnit& result,
+        float* spectrum) const {
+    SpectralSubbandArray& resultSubbands = result.spectralBands;
     int numSubbands = bitstream.getBits(5) + 1;
     CodingMode codingMode = static_cast<CodingMode>(bitstream.getBit());
     resultSubbands.resize(static_cast<size_t>(numSubbands));
 
-    // Get 3 bits selector tables, get range, and init values to 0
+    // Get 3 bits selector tables, get range, and reserve values. The subbands
+    // cover at most the whole spectrum, so there is always room for them.
     for (int i=0; i<numSubbands; ++i) {
       SpectralSubband& subband = resultSubbands[i];
       subband.tableSelector = bitstream.getBits(3);
@@ -203,7 +520,7 @@ namespace Atrac3Frame {
           i, subband.startFrequency, subband.numValues)) {
         return false;
       }
-      subband.mantissas.assign(static_cast<size_t>(subband.numValues), 0);
+      subband.mantissaOffset = (spectrum ? 0 : result.reserveMantissas(subband.numValues));
     }
 
     // Get 6 bits scale factor index for each unskipped subband
@@ -215,45 +532,69 @@ namespace Atrac3Frame {
         _constants.inverseQuantization[subband.tableSelector];
     }
 
-    // Read values for each unskipped subband
+    // Read values for each subband. Skipped subbands have all zero values, which
+    // add nothing to a spectrum.
+    int values[kMaxValuesPerSpectralSubband];
     for (SpectralSubband& subband : resultSubbands) {
-      if (subband.tableSelector != 0) {
-        if (!parseEncodedValues(bitstream, codingMode,
-          subband.tableSelector, subband.numValues, subband.mantissas)) {
-          return false;
+      if (subband.tableSelector == 0) {
+        if (!spectrum) {
+          std::fill_n(result.mantissas.data() + subband.mantissaOffset, subband.numValues, 0);
         }
+        continue;
+      }
+      if (!parseEncodedValues(bitstream, codingMode,
+        subband.tableSelector, subband.numValues, values)) {
+        return false;
+      }
+      result.codedSubbandMask |= getSubbandMask(subband.startFrequency, subband.numValues);
+      if (spectrum) {
+        accumulateValues(spectrum, subband.startFrequency, values,
+          subband.numValues, subband.scaleFactor);
+      } else {
+        storeValues(result.mantissas.data() + subband.mantissaOffset, values, subband.numValues);
       }
     }
     return true;
   }
 
 
-  bool Parser::parseEncodedValues(
-          IBitstreamReader& bitstream,
+  template<typename Statistics>
+  template<typename Reader>
+  bool BasicParser<Statistics>::parseEncodedValues(
+          Reader& bitstream,
           CodingMode codingMode,
           int tableIndex,
           int numValues,
-          std::vector<int>& result) const {
+          int* result) const {
       // tableIndex != 0 for spectrum
       // tableIndex !=0 and !=1 for tonal
+      size_t remainingBits = _statistics.beginEncodedValues(bitstream);
+      bool success = false;
       switch (codingMode) {
         case CodingMode::ConstantLengthCoded:
-          return parseConstantLengthEncodedValues(bitstream, tableIndex, numValues, result);
+          success = parseConstantLengthEncodedValues(bitstream, tableIndex, numValues, result);
+          break;
         case CodingMode::VariableLengthCoded:
-          return parseVariableLengthEncodedValues(bitstream, tableIndex, numValues, result);
-        default:
+          success = parseVariableLengthEncodedValues(bitstream, tableIndex, numValues, result,
+            _statistics.getCodeLengthCounter(tableIndex));
           break;
+        default:
+          return false;
       }
-    return false;
+      if (success) {
+        _statistics.countEncodedValues(bitstream, codingMode, tableIndex, numValues, remainingBits);
+      }
+      return success;
   }
 
 
-  bool Parser::parseConstantLengthEncodedValues(
-        IBitstreamReader& bitstream,
+  template<typename Statistics>
+  template<typename Reader>
+  bool BasicParser<Statistics>::parseConstantLengthEncodedValues(
+        Reader& bitstream,
         int tableIndex,
         int numValues,
-        std::vector<int>& result) const {
-    result.resize(static_cast<size_t>(numValues));
+        int* result) const {
 
     if (tableIndex <= 0) {
       for (int i=0; i<numValues; ++i) {
@@ -272,19 +613,20 @@ namespace Atrac3Frame {
       //constexpr int kMantissaBitLengths[8] = { 0, 0/*4*/, 3, 3, 4, 4, 5, 6 };
       //int numBits = kMantissaBitLengths[tableIndex];
       int numBits = _constants.constantLengthNumBits[tableIndex];
-      for (int i = 0; i < numValues; ++i) {
-        result[i] = bitstream.getSignedBits(numBits);
-      }
+      bitstream.getSignedBitFields(static_cast<size_t>(numBits),
+        static_cast<size_t>(numValues), result);
     }
     return true;
   }
 
-  bool Parser::parseVariableLengthEncodedValues(
-        IBitstreamReader& bitstream,
+  template<typename Statistics>
+  template<typename Reader, typename CodeLengthCounter>
+  bool BasicParser<Statistics>::parseVariableLengthEncodedValues(
+        Reader& bitstream,
         int tableIndex,
         int numValues,
-        std::vector<int>& result) const {
-    result.resize(static_cast<size_t>(numValues));
+        int* result,
+        const CodeLengthCounter& counter) const {
     if (tableIndex < 0) {
       for (int i=0; i<numValues; ++i) {
         result[i] = 0;
@@ -292,29 +634,47 @@ namespace Atrac3Frame {
     } else if (tableIndex == 1) {
       // The even/odd pairs in this table cover all combinations
       // of -1,0, and 1, allowing a single Huffman-coded index to
-      // efficiently specify two values.
-      constexpr int kMantissaTable[18] = {
-        0, 0, 0, 1, 0, -1, 1, 0, -1, 0,
-        1, 1, 1, -1, -1, 1, -1, -1
-      };
+      // efficiently specify two values. The table expands each
+      // code through vlcTable1Mantissas.
       // TODO: make sure numValues is always even for table 1?
       const HuffmanTable& table = _constants.huffmanTables[tableIndex];
-      for (int i=0; i<numValues; i+=2) {
-        int code = table.readCode(bitstream);
-        result[i] = kMantissaTable[code*2];
-        result[i+1] = kMantissaTable[code*2+1];
+      int i = 0;
+      while (i < numValues) {
+        i += table.readValues(bitstream, numValues - i, &result[i], counter);
+        // An invalid code reads as index 0, a pair of zeroes
+        for (int j=0; j<2 && i<numValues; ++j) {
+          result[i++] = _constants.vlcTable1Mantissas[j];
+        }
       }
     } else {
-      //printf("table %d\n", tableIndex);
       const HuffmanTable& table = _constants.huffmanTables[tableIndex];
-      if (!table.readCodes(bitstream, (int)result.size(), result)) {
+      if (table.readValues(bitstream, numValues, result, counter) != numValues) {
         LogDebug(kLogCategory, "parseVariableLengthEncodedValues failed to read codes");
         return false;
       }
-      //PrintIntVector(result);
     }
     return true;
   }
 
-} // namespace
+  // Explicit instantiations for the statistics policies and supported reader types
+  template class BasicParser<NoStatistics>;
+  template class BasicParser<CollectStatistics>;
+
+#define INSTANTIATE_PARSER_READER(Statistics, Reader) \
+  template bool BasicParser<Statistics>::parseSoundUnit(Reader& bitstream, \
+    SoundUnit& result) const; \
+  template bool BasicParser<Statistics>::parseSoundUnit(Reader& bitstream, \
+    SoundUnit& result, float* spectrum, SoundUnitHeader header) const; \
+  template bool BasicParser<Statistics>::skimSoundUnit(Reader& bitstream, \
+    SoundUnitSummary& result, SoundUnitHeader header) const; \
+  template void BasicParser<Statistics>::parseJointStereoParameters(Reader& bitstream, \
+    JointStereoParameters& result) const;
+
+  INSTANTIATE_PARSER_READER(NoStatistics, IBitstreamReader)
+  INSTANTIATE_PARSER_READER(NoStatistics, BitstreamReader)
+  INSTANTIATE_PARSER_READER(NoStatistics, UncheckedBitstreamReader)
+  INSTANTIATE_PARSER_READER(CollectStatistics, IBitstreamReader)
+  INSTANTIATE_PARSER_READER(CollectStatistics, BitstreamReader)
+  INSTANTIATE_PARSER_READER(CollectStatistics, UncheckedBitstreamReader)
 
+} // namespace
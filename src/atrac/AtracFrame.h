@@ -1,7 +1,9 @@
 #pragma once
 
 #include "AtracConstants.h"
+#include "AtracStatistics.h"
 #include "io/Bitstream.h"
+#include "util/FixedArray.h"
 
 namespace Atrac3Frame {
 
@@ -34,9 +36,20 @@ namespace Atrac3Frame {
     uint8_t levelCode; // 4 bits
     uint8_t locationCode; // 5 bits, offset within the frame, in multiples of 8 samples
   };
-  using GainDataPointArray = std::vector<GainDataPoint>;
+  using GainDataPointArray = FixedArray<GainDataPoint, Atrac3::kMaxGainCompensationPointsPerSubband>;
 
 
+  // Maximum counts of the arrays in a SoundUnit
+  constexpr int kMaxValuesPerTonalComponent = 8; // 3 bits
+  constexpr int kMaxTonalComponentGroups = 31; // 5 bits
+  constexpr int kMaxSpectralSubbands = 32; // 5 bits
+  constexpr int kMaxValuesPerSpectralSubband = 128; // largest BFU
+  // Every tonal component takes at least 12 bits plus a bit per value, so no sound
+  // unit can hold this many tonal values
+  constexpr int kMaxTonalValuesPerSoundUnit = 1024;
+  constexpr int kMaxMantissasPerSoundUnit =
+    Atrac3::kNumFrequenciesInSpectrum + kMaxTonalValuesPerSoundUnit;
+
   // Tonal components are harmonically-important frequencies that are independently extracted
   // from the overall spectrum (from each of the 4 QMF subbands), allowing those frequencies
   // to be encoded with high precision or accuracy. After subtracting these components from the
@@ -50,29 +63,25 @@ namespace Atrac3Frame {
   // in the group. Each child tonal component specifies a starting frequency offset and an array
   // of amplitudes.
   //
-  // A single audio frame may contain up to 31 tonal groups, and each group may contain
-  // up to 7 components.
+  // A single audio frame may contain up to 31 tonal groups. Each group may contain up to
+  // 7 components per tonal bin, and up to kMaxTonalComponentsPerGroup in all.
   struct TonalComponent {
     int scaleFactorIndex = 0; // 0-63
     int positionOffset = 0; // start offset within the tonal bin, 0-63
     int tonalBin = 0; // major start offset within the frequency spectrum (64 frequencies per bin)
     int tableSelector = 0; // huffman table, same as quantization step index
 
-    // Unscaled amplitude values. Signed integers within the range of the associated quantization table.
-    std::vector<int> mantissas;
-
     int startFrequency = 0; // Position within the 1024 frequency spectrum
+    int numValues = 0; // 1-8, fewer if truncated at the end of the spectrum
+    int mantissaOffset = 0; // first value in SoundUnit::mantissas
     float scaleFactor = 1;
-// TODO: TonalComponent and SpectralSubband should both inherit from a
-// subclass so it's easy to accumulate arrays of them into the spectrum.
-// Or at least have the same value names so a template works.
   };
 
   struct TonalComponentGroup {
     int numValuesPerChildComponent = 0; // 1-8
     int quantizationStepIndex = 0; // table lookup index, 2-7
     CodingMode codingMode = CodingMode::Invalid;
-    std::vector<TonalComponent> childComponents;
+    FixedArray<TonalComponent, Atrac3::kMaxTonalComponentsPerGroup> childComponents;
   };
 
   // Part of a SoundUnit
@@ -82,64 +91,293 @@ namespace Atrac3Frame {
 
     int startFrequency = 0;
     int numValues = 0;
-    std::vector<int> mantissas;
+    int mantissaOffset = 0; // first value in SoundUnit::mantissas
 
     float scaleFactor = 1;
   };
 
+  using GainCompensationBandArray = FixedArray<GainDataPointArray, Atrac3::kNumSubbands>;
+  using TonalComponentGroupArray = FixedArray<TonalComponentGroup, kMaxTonalComponentGroups>;
+  using SpectralSubbandArray = FixedArray<SpectralSubband, kMaxSpectralSubbands>;
+
   // The primary encoding block for a channel of ATRAC3 data.
   // Each stereo frame has 2 sound units.
+  //
+  // All arrays have inline storage for the format's maximum counts, so parsing into
+  // an existing SoundUnit never allocates. This makes a SoundUnit large (69232 bytes
+  // on x86-64, mostly the tonal groups), so keep long-lived instances rather than
+  // creating one per parse.
   struct SoundUnit {
     // Gain compensation interpolation points for each subband.
     // 4 arrays of gain points.
-    std::vector<GainDataPointArray> gainCompensationBands; // 2 bits = (numBands-1)
+    GainCompensationBandArray gainCompensationBands; // 2 bits = (numBands-1)
 
     // Up to 31 tonal components define musically-relevant frequencies
-    std::vector<TonalComponentGroup> tonalGroups; // 5 bits num groups
+    TonalComponentGroupArray tonalGroups; // 5 bits num groups
+
+    SpectralSubbandArray spectralBands; // 5 bits num subbands
+
+    // Unscaled amplitude values of all tonal components and spectral subbands, in
+    // parse order. Each refers to its values with mantissaOffset and numValues.
+    // Signed integers within the range of the associated quantization table.
+    FixedArray<int16_t, kMaxMantissasPerSoundUnit> mantissas;
+
+    // Bit N is set if any tonal component or spectral subband has values in QMF
+    // subband N. Parsing into a spectrum only adds values within these subbands, even
+    // for a sound unit that failed part way, so the others are left all zero.
+    uint8_t codedSubbandMask = 0;
+
+    // The values of a tonal component or spectral subband
+    template<typename Entry>
+    const int16_t* getMantissas(const Entry& entry) const {
+      return mantissas.data() + entry.mantissaOffset;
+    }
+
+    // Reserve numValues uninitialized values at the end of the mantissas.
+    // @return Offset of the first value, or -1 if there is no room
+    int reserveMantissas(int numValues) {
+      int offset = static_cast<int>(mantissas.size());
+      return (mantissas.resize(mantissas.size() + numValues) ? offset : -1);
+    }
+
+    // Empty all arrays, without releasing or reinitializing any storage
+    void clear() {
+      gainCompensationBands.clear();
+      tonalGroups.clear();
+      spectralBands.clear();
+      mantissas.clear();
+      codedSubbandMask = 0;
+    }
+  };
 
-    std::vector<SpectralSubband> spectralBands; // 5 bits num subbands
+  // Metadata of a sound unit, read by Parser::skimSoundUnit without decoding its
+  // spectrum. Compact enough to keep for every sound unit of a long stream.
+  struct SoundUnitSummary {
+    uint8_t numEncodedQmfBands = 0; // 1-4
+    uint8_t numGainPoints[Atrac3::kNumSubbands] = {}; // per encoded QMF band, 0-7
+    uint8_t numTonalGroups = 0; // 0-31
+    uint16_t numTonalComponents = 0; // total over all groups
+    uint8_t numSpectralSubbands = 0; // 1-32, the number of BFUs
+    CodingMode spectralCodingMode = CodingMode::Invalid;
+    uint8_t tableSelectors[kMaxSpectralSubbands] = {}; // per spectral subband, 0 if skipped
   };
 
+  // How a sound unit starts in the bitstream
+  enum class SoundUnitHeader : uint8_t {
+    Standard, // 6 bit magic header 0x28, for dual mono and first joint stereo sound units
+    JointStereoSecond, // 2 bit id 3, for the second sound unit of a joint stereo block
+  };
+
+  // The stereo coding of a joint stereo block, stored between its two sound units.
+  // The defaults are the state before the first block.
+  struct JointStereoParameters {
+    // Channel weighting of QMF bands 1-3. Index 7 weights both channels equally,
+    // otherwise the first channel is scaled by index/7, and the second so that the
+    // squares of both add up to 2. The swap flag exchanges the two weights.
+    uint8_t swapWeights = 0; // 1 bit
+    uint8_t weightIndex = 7; // 3 bits
+
+    // How the two channels of each QMF band reconstruct left and right, see
+    // Atrac3Render::renderJointStereoSpectra
+    uint8_t matrixSelectors[Atrac3::kNumSubbands] = { 3, 3, 3, 3 }; // 2 bits each
+  };
+
+
+  // The statistics policy of a BasicParser, whose hooks it calls while parsing a sound
+  // unit. Each hook that takes remainingBits counts the bits read since then, and
+  // moves remainingBits to the current position. NoStatistics does nothing in any
+  // hook, so the default Parser compiles them all away.
+  struct NoStatistics {
+    template<typename Reader>
+    size_t beginSoundUnit(Reader& /*bitstream*/) const { return 0; }
+    template<typename Reader>
+    void countHeader(Reader& /*bitstream*/, int /*numEncodedQmfBands*/,
+      size_t& /*remainingBits*/) const {}
+    template<typename Reader>
+    void countSection(Reader& /*bitstream*/, DecodeStatistics::Section /*section*/,
+      const SoundUnit& /*soundUnit*/, size_t& /*remainingBits*/) const {}
+    void countParsedSoundUnit(size_t /*remainingBits*/) const {}
+
+    template<typename Reader>
+    size_t beginEncodedValues(Reader& /*bitstream*/) const { return 0; }
+    template<typename Reader>
+    void countEncodedValues(Reader& /*bitstream*/, CodingMode /*codingMode*/,
+      int /*tableIndex*/, int /*numValues*/, size_t /*remainingBits*/) const {}
+    HuffmanTable::NoCodeLengthCounter getCodeLengthCounter(int /*tableIndex*/) const {
+      return HuffmanTable::NoCodeLengthCounter();
+    }
+  };
+
+  // Adds every sound unit parsed to a DecodeStatistics, which must outlive the parser.
+  // The statistics aren't thread safe, so neither is parsing with this policy.
+  class CollectStatistics {
+  public:
+    CollectStatistics(DecodeStatistics& statistics) : _statistics(&statistics) {}
+
+    // Counts the codes that HuffmanTable::readValues consumes from one table
+    struct CodeLengthCounter {
+      static constexpr bool kIsCounting = true;
+      void countCode(int numBits) const { ++codeLengths[numBits]; }
+      uint64_t* codeLengths;
+    };
+
+    template<typename Reader>
+    size_t beginSoundUnit(Reader& bitstream) const;
+    template<typename Reader>
+    void countHeader(Reader& bitstream, int numEncodedQmfBands, size_t& remainingBits) const;
+    template<typename Reader>
+    void countSection(Reader& bitstream, DecodeStatistics::Section section,
+      const SoundUnit& soundUnit, size_t& remainingBits) const;
+    void countParsedSoundUnit(size_t remainingBits) const;
+
+    template<typename Reader>
+    size_t beginEncodedValues(Reader& bitstream) const { return bitstream.getRemainingBits(); }
+    template<typename Reader>
+    void countEncodedValues(Reader& bitstream, CodingMode codingMode, int tableIndex,
+      int numValues, size_t remainingBits) const;
+    CodeLengthCounter getCodeLengthCounter(int tableIndex) const {
+      return CodeLengthCounter{_statistics->codeLengths[tableIndex]};
+    }
 
-  class Parser {
+  private:
+    template<typename Reader>
+    void countSectionBits(Reader& bitstream, DecodeStatistics::Section section,
+      size_t& remainingBits) const;
+
+    DecodeStatistics* _statistics;
+  };
+
+  // Parses sound units, collecting statistics as chosen by the Statistics policy at
+  // compile time. Use Parser, unless collecting statistics with a StatisticsParser.
+  template<typename Statistics>
+  class BasicParser {
   public:
-    // TODO? Are there configuration options for parsing? Certainly LP2 vs LP4
+    explicit BasicParser(const Statistics& statistics = Statistics()) :
+      _statistics(statistics) {}
 
     // Parse a single sound unit from a bitstream.
+    // The parser is templated on the reader so the common BitstreamReader path is
+    // resolved (and inlined) at compile time. Instantiated for IBitstreamReader,
+    // BitstreamReader and UncheckedBitstreamReader.
+    // Bits are read without per-read bounds checks; the whole sound unit is checked
+    // once at the end, and fails if the data overran the bitstream.
+    //
+    // The result is parsed into existing storage: all of its previous contents are
+    // replaced, but its arrays are only cleared, never reallocated. Callers should
+    // keep one SoundUnit per channel and pass it to every parse, so that decoding
+    // a long stream performs no allocations. If parsing fails, the result holds
+    // whatever was parsed up to the error.
     // @param bitstream A bitstream for a single sound unit of data (192 bytes for LP2)
-    // @return Number of bytes read, or -1 if error
-    int parseSoundUnit(IBitstreamReader& bitstream, SoundUnit& result) const;
+    // @param result The sound unit to overwrite
+    // @return Whether successful
+    template<typename Reader>
+    bool parseSoundUnit(Reader& bitstream, SoundUnit& result) const;
 
-  private:
+    // Parse a single sound unit, dequantizing its tonal components and spectral subbands
+    // straight into a spectrum as they are decoded, instead of storing their mantissas.
+    // The spectrum matches what Atrac3Render accumulates from a structured parse, exactly.
+    // The result holds the gain compensation bands as usual, but only the parameters
+    // of the tonal groups (with no child components) and spectral subbands (with no
+    // stored mantissas).
+    // Only the coded values are added, so the spectrum must start out all zero, as
+    // Atrac3Render::renderSubbands leaves it. Clearing a whole spectrum per sound unit
+    // would mostly write zeros over zeros.
+    // @param spectrum kNumFrequenciesInSpectrum values to add to, all zero, or null to
+    //   parse as above
+    // @param header The header to expect, which differs for second joint stereo sound units
+    // @return Whether successful
+    template<typename Reader>
+    bool parseSoundUnit(Reader& bitstream, SoundUnit& result, float* spectrum,
+      SoundUnitHeader header = SoundUnitHeader::Standard) const;
+
+    // Read only the metadata of a sound unit. Tonal components are skipped over, which
+    // decodes only variable length coded tonal values, and reading stops after the
+    // spectral subband table selectors, so no spectral values are decoded.
+    // @param bitstream A bitstream for a single sound unit of data (192 bytes for LP2)
+    // @return Whether successful. Fails on invalid data, like parseSoundUnit, except
+    //   for errors within the spectral values.
+    template<typename Reader>
+    bool skimSoundUnit(Reader& bitstream, SoundUnitSummary& result,
+      SoundUnitHeader header = SoundUnitHeader::Standard) const;
+
+    // Joint stereo (LP4) blocks also hold one sound unit per channel, but share one
+    // block of data between them. The first sound unit reads forward from the start of
+    // the block. The second is stored backwards from the end of the block, after a run
+    // of sync bytes, and starts with the JointStereoParameters and a 2 bit header.
 
+    // Copy the data of the second sound unit of a joint stereo block in forward order.
+    // @param result At least blockSize + kBitstreamGuardBytes bytes, set to the data
+    //   followed by zeroes
+    // @return Number of bytes of data, or 0 if the block has no room for a sound unit
+    static int reverseJointStereoSecondUnit(const uint8_t* block, int blockSize, uint8_t* result);
+
+    // Read the joint stereo parameters at the start of a reversed second sound unit
+    template<typename Reader>
+    void parseJointStereoParameters(Reader& bitstream, JointStereoParameters& result) const;
+
+    // Parse both sound units of a joint stereo block, as parseSoundUnit.
+    // @param block The block data, followed by kBitstreamGuardBytes readable bytes
+    // @param soundUnits The 2 sound units to overwrite
+    // @param spectra Spectrum of each sound unit to add to, all zero, or null for both
+    //   to parse structured sound units
+    // @param isValid Set to whether each sound unit parsed successfully. The second is
+    //   parsed even if the first fails, as it doesn't depend on where the first ends.
+    // @return Whether both sound units parsed successfully
+    bool parseJointStereoBlock(const uint8_t* block, int blockSize, SoundUnit* soundUnits,
+      float* const* spectra, JointStereoParameters& parameters, bool* isValid) const;
+
+  private:
     // Control points for the gain compensation, up to 7 points per subband.
-    bool parseGainCompensationSubbands(IBitstreamReader& bitstream,
-      std::vector<GainDataPointArray>& subbands, int numEncodedSubbands) const;
+    template<typename Reader>
+    bool parseGainCompensationSubbands(Reader& bitstream,
+      GainCompensationBandArray& subbands, int numEncodedSubbands) const;
 
     // Tonal components, specific frequencies with high amplitude or high precision
     // that generally are dissimilar from the surrounding spectrum.
-    bool parseTonalComponentGroups(IBitstreamReader& bitstream, int numEncodedBands,
-      std::vector<TonalComponentGroup>& tonalGroups) const;
-    bool parseTonalComponentGroup( IBitstreamReader& bitstream, int numEncodedBands,
-      CodingMode defaultCodingMode, TonalComponentGroup& resultGroup) const;
-    bool parseTonalComponent(IBitstreamReader& bitstream,
+    // If spectrum is set, components are added to it rather than kept in the groups.
+    template<typename Reader>
+    bool parseTonalComponentGroups(Reader& bitstream, int numEncodedBands,
+      SoundUnit& result, float* spectrum) const;
+    template<typename Reader>
+    bool parseTonalComponentGroup( Reader& bitstream, int numEncodedBands,
+      CodingMode defaultCodingMode, TonalComponentGroup& resultGroup,
+      SoundUnit& result, float* spectrum) const;
+    template<typename Reader>
+    bool parseTonalComponent(Reader& bitstream,
       CodingMode codingMode, int quantizationStepIndex, int numValuesPerComponent,
-      int tonalBin, TonalComponent& result) const;
-
-    // Residual spectral amplitudes per freuency, 32 subbands of unequal size
-    bool parseSpectralSubbands(IBitstreamReader& bitstream,
-      std::vector<SpectralSubband>& resultSubbands) const;
-
-    // Parse frequency mantissas, either constant length or variable length coded
-    bool parseEncodedValues(IBitstreamReader& bitstream,
-      CodingMode codingMode, int tableIndex, int numValues, std::vector<int>& result) const;
-    bool parseConstantLengthEncodedValues(IBitstreamReader& bitstream,
-      int tableIndex, int numValues, std::vector<int>& result) const;
-    bool parseVariableLengthEncodedValues(IBitstreamReader& bitstream,
-      int tableIndex, int numValues, std::vector<int>& result) const;
-
-    // Constant data from the ATRAC spec
-    Atrac3::Atrac3Constants _constants;
+      int tonalBin, TonalComponent& result, int* values) const;
+
+    // Move past the tonal component groups, counting them in the summary
+    template<typename Reader>
+    bool skipTonalComponentGroups(Reader& bitstream, int numEncodedBands,
+      SoundUnitSummary& result) const;
+
+    // Residual spectral amplitudes per freuency, 32 subbands of unequal size.
+    // If spectrum is set, values are added to it rather than kept in the subbands.
+    template<typename Reader>
+    bool parseSpectralSubbands(Reader& bitstream,
+      SoundUnit& result, float* spectrum) const;
+
+    // Parse frequency mantissas, either constant length or variable length coded,
+    // into numValues entries of result
+    template<typename Reader>
+    bool parseEncodedValues(Reader& bitstream,
+      CodingMode codingMode, int tableIndex, int numValues, int* result) const;
+    template<typename Reader>
+    bool parseConstantLengthEncodedValues(Reader& bitstream,
+      int tableIndex, int numValues, int* result) const;
+    template<typename Reader, typename CodeLengthCounter>
+    bool parseVariableLengthEncodedValues(Reader& bitstream,
+      int tableIndex, int numValues, int* result, const CodeLengthCounter& counter) const;
+
+    // Constant data from the ATRAC spec, shared by all parsers
+    const Atrac3::Atrac3Constants& _constants = Atrac3::Atrac3Constants::getShared();
+
+    Statistics _statistics;
   };
 
+  // Instantiated in AtracFrame.cpp for these policies only
+  using Parser = BasicParser<NoStatistics>;
+  using StatisticsParser = BasicParser<CollectStatistics>;
+
 }
@@ -0,0 +1,120 @@
+#include "AtracMixKernel.h"
+
+// Every kernel must round each multiply and add separately to give identical output,
+// so don't let the compiler fuse them into multiply-adds. Clang does so by default
+// within an expression on arm64, and GCC does across statements and even intrinsics
+// wherever FMA is available.
+#if defined(__clang__)
+  #pragma STDC FP_CONTRACT OFF
+#elif defined(__GNUC__)
+  #pragma GCC optimize("fp-contract=off")
+#endif
+
+#if defined(__x86_64__) || defined(_M_X64) || (defined(__i386__) && defined(__SSE2__))
+  #define ATRAC_MIX_SSE2 1
+  #include <emmintrin.h>
+  // The AVX kernel is compiled for AVX on its own, and only called if the CPU has it
+  #if defined(__GNUC__)
+    #define ATRAC_MIX_AVX 1
+    #include <immintrin.h>
+  #endif
+#endif
+
+namespace {
+
+  constexpr int kNumOverlapSamples = 256;
+
+  void mixScalar(const float* unscaled, const float* window, const float* gainRamp,
+      float gain, float leadInScale, const float* prevOverlap, float* mix, float* nextOverlap,
+      int numSamples) {
+    for (int i=0; i<numSamples; ++i) {
+      const float sampleGain = (gainRamp ? gainRamp[i] : gain);
+      mix[i] = sampleGain * (unscaled[i] * window[i] * leadInScale + prevOverlap[i]);
+    }
+    for (int i=0; i<numSamples; ++i) {
+      nextOverlap[i] = unscaled[i + kNumOverlapSamples] * window[i + kNumOverlapSamples];
+    }
+  }
+
+#if ATRAC_MIX_SSE2
+  void mixSse2(const float* unscaled, const float* window, const float* gainRamp,
+      float gain, float leadInScale, const float* prevOverlap, float* mix, float* nextOverlap,
+      int numSamples) {
+    const __m128 scale = _mm_set1_ps(leadInScale);
+    const __m128 constantGain = _mm_set1_ps(gain);
+    for (int i=0; i<numSamples; i+=4) {
+      __m128 windowed = _mm_mul_ps(_mm_loadu_ps(unscaled + i), _mm_loadu_ps(window + i));
+      __m128 mixed = _mm_add_ps(_mm_mul_ps(windowed, scale), _mm_loadu_ps(prevOverlap + i));
+      __m128 sampleGain = (gainRamp ? _mm_loadu_ps(gainRamp + i) : constantGain);
+      _mm_storeu_ps(mix + i, _mm_mul_ps(sampleGain, mixed));
+      _mm_storeu_ps(nextOverlap + i, _mm_mul_ps(
+        _mm_loadu_ps(unscaled + kNumOverlapSamples + i),
+        _mm_loadu_ps(window + kNumOverlapSamples + i)));
+    }
+  }
+#endif
+
+#if ATRAC_MIX_AVX
+  __attribute__((target("avx")))
+  void mixAvx(const float* unscaled, const float* window, const float* gainRamp,
+      float gain, float leadInScale, const float* prevOverlap, float* mix, float* nextOverlap,
+      int numSamples) {
+    const __m256 scale = _mm256_set1_ps(leadInScale);
+    const __m256 constantGain = _mm256_set1_ps(gain);
+    for (int i=0; i<numSamples; i+=8) {
+      __m256 windowed = _mm256_mul_ps(_mm256_loadu_ps(unscaled + i), _mm256_loadu_ps(window + i));
+      __m256 mixed = _mm256_add_ps(_mm256_mul_ps(windowed, scale), _mm256_loadu_ps(prevOverlap + i));
+      __m256 sampleGain = (gainRamp ? _mm256_loadu_ps(gainRamp + i) : constantGain);
+      _mm256_storeu_ps(mix + i, _mm256_mul_ps(sampleGain, mixed));
+      _mm256_storeu_ps(nextOverlap + i, _mm256_mul_ps(
+        _mm256_loadu_ps(unscaled + kNumOverlapSamples + i),
+        _mm256_loadu_ps(window + kNumOverlapSamples + i)));
+    }
+    // Avoid the penalty of mixing AVX and SSE code afterwards
+    _mm256_zeroupper();
+  }
+#endif
+
+  Atrac3Render::SubbandMixKernel findFastestKernel() {
+    using Atrac3Render::SimdLevel;
+    const SimdLevel levels[] = { SimdLevel::AVX, SimdLevel::SSE2 };
+    for (SimdLevel level : levels) {
+      Atrac3Render::SubbandMixKernel kernel = Atrac3Render::getSubbandMixKernel(level);
+      if (kernel) {
+        return kernel;
+      }
+    }
+    return mixScalar;
+  }
+
+} // namespace
+
+namespace Atrac3Render {
+
+  SubbandMixKernel getSubbandMixKernel(SimdLevel level) {
+    switch (level) {
+      case SimdLevel::Scalar:
+        return mixScalar;
+      case SimdLevel::SSE2:
+#if ATRAC_MIX_SSE2
+        return mixSse2;
+#else
+        return nullptr;
+#endif
+      case SimdLevel::AVX:
+#if ATRAC_MIX_AVX
+        return (__builtin_cpu_supports("avx") ? mixAvx : nullptr);
+#else
+        return nullptr;
+#endif
+    }
+    return nullptr;
+  }
+
+  SubbandMixKernel getSubbandMixKernel() {
+    // Function-local statics are initialized exactly once, even with concurrent callers
+    static const SubbandMixKernel fastest = findFastestKernel();
+    return fastest;
+  }
+
+}
@@ -0,0 +1,38 @@
+#pragma once
+
+namespace Atrac3Render {
+
+  // Windows the inverse DCT of one QMF subband and overlap-adds it with the previous
+  // frame in a single pass, for a span of the 256 samples of the overlap:
+  //   mix[i] = gain[i] * (unscaled[i]*window[i] * leadInScale + prevOverlap[i])
+  //   nextOverlap[i] = unscaled[i+256] * window[i+256]
+  // The gain compensation curve is made of 8-sample ramps and constant runs, so the
+  // caller passes one segment of it per span, and no curve is ever rendered. The
+  // operations are the same and in the same order as separate passes, and are never
+  // fused into multiply-adds, so every implementation produces identical output.
+  // @param unscaled The inverse DCT of the subband, at the start of the span
+  // @param window The decoding window, at the start of the span
+  // @param gainRamp The span's gain per sample, or nullptr for constant gain
+  // @param gain The span's constant gain, if gainRamp is nullptr
+  // @param leadInScale Constant scale of this frame's lead-in
+  // @param prevOverlap The previous frame's windowed lead-out, at the start of the span
+  // @param mix The samples to upsample, the QMF input, at the start of the span
+  // @param nextOverlap Set to this frame's windowed lead-out, for the next frame
+  // @param numSamples Size of the span, a multiple of 8
+  using SubbandMixKernel = void (*)(const float* unscaled, const float* window,
+    const float* gainRamp, float gain, float leadInScale, const float* prevOverlap,
+    float* mix, float* nextOverlap, int numSamples);
+
+  enum class SimdLevel {
+    Scalar,
+    SSE2,
+    AVX, // 8-wide, as AVX2 adds nothing for float multiplies and adds
+  };
+
+  // The kernel for an instruction set, or nullptr if the build or this CPU lacks it
+  SubbandMixKernel getSubbandMixKernel(SimdLevel level);
+
+  // The fastest kernel for this CPU, detected on first use
+  SubbandMixKernel getSubbandMixKernel();
+
+}
@@ -0,0 +1,84 @@
+#include "AtracPipeline.h"
+
+namespace Atrac3Frame {
+
+  PipelinedParser::PipelinedParser(const Parser& parser, const Atrac3::StreamMode& mode,
+      const uint8_t* data, int numBlocks, int numThreads, int depth) :
+    _parser(parser),
+    _bytesPerStereoBlock(mode.bytesPerStereoBlock),
+    _isJointStereo(mode.isJointStereo),
+    _data(data),
+    _numBlocks(numBlocks),
+    _depth(depth < 1 ? 1 : depth),
+    _slots(new Slot[_depth]),
+    _nextBlockToParse(0),
+    _isStopping(false) {
+    for (int i=0; i<_depth; ++i) {
+      _slots[i].sequence.store(2 * i, std::memory_order_relaxed);
+      for (FloatArray& spectrum : _slots[i].block.spectra) {
+        spectrum.assign(Atrac3::kNumFrequenciesInSpectrum, 0.0f); // kept clear by the caller
+      }
+    }
+    for (int i=0; i < (numThreads < 1 ? 1 : numThreads); ++i) {
+      _workers.emplace_back(&PipelinedParser::runWorker, this);
+    }
+  }
+
+  PipelinedParser::~PipelinedParser() {
+    _isStopping.store(true);
+    for (std::thread& worker : _workers) {
+      worker.join();
+    }
+  }
+
+  PipelinedParser::Block& PipelinedParser::acquire(int blockIndex) {
+    Slot& slot = _slots[blockIndex % _depth];
+    waitForSequence(slot, 2 * blockIndex + 1);
+    return slot.block;
+  }
+
+  void PipelinedParser::release(int blockIndex) {
+    Slot& slot = _slots[blockIndex % _depth];
+    slot.sequence.store(2 * (blockIndex + _depth), std::memory_order_release);
+  }
+
+  void PipelinedParser::runWorker() {
+    UncheckedBitstreamReader bitstream(nullptr, 0);
+    while (true) {
+      int blockIndex = _nextBlockToParse.fetch_add(1);
+      if (blockIndex >= _numBlocks) {
+        return;
+      }
+      Slot& slot = _slots[blockIndex % _depth];
+      if (!waitForSequence(slot, 2 * blockIndex)) {
+        return;
+      }
+      Block& block = slot.block;
+      const uint8_t* blockData = _data + blockIndex * _bytesPerStereoBlock;
+      if (_isJointStereo) {
+        float* spectra[2] = { block.spectra[0].data(), block.spectra[1].data() };
+        _parser.parseJointStereoBlock(blockData, _bytesPerStereoBlock, block.soundUnits,
+          spectra, block.jointStereo, block.isValid);
+      } else {
+        const int bytesPerSoundUnit = _bytesPerStereoBlock / 2;
+        for (int channel=0; channel<2; ++channel) {
+          bitstream.reset(blockData + channel * bytesPerSoundUnit, bytesPerSoundUnit);
+          block.isValid[channel] = _parser.parseSoundUnit(bitstream,
+            block.soundUnits[channel], block.spectra[channel].data());
+        }
+      }
+      slot.sequence.store(2 * blockIndex + 1, std::memory_order_release);
+    }
+  }
+
+  bool PipelinedParser::waitForSequence(const Slot& slot, int sequence) const {
+    while (slot.sequence.load(std::memory_order_acquire) != sequence) {
+      if (_isStopping.load(std::memory_order_relaxed)) {
+        return false;
+      }
+      std::this_thread::yield();
+    }
+    return true;
+  }
+
+}
@@ -0,0 +1,87 @@
+#pragma once
+
+#include "AtracFrame.h"
+#include "util/ArrayUtil.h"
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace Atrac3Frame {
+
+  // Parses the stereo blocks of a stream ahead of rendering, on worker threads.
+  //
+  // Parsing a sound unit doesn't depend on any other, so workers parse upcoming blocks
+  // in parallel into a ring of slots, while the caller renders them in order. Each slot
+  // has an atomic sequence number that hands it between one worker and the caller
+  // without locks:
+  //   2*b      free, for the worker that claims block b
+  //   2*b + 1  block b is parsed, for the caller
+  // Releasing block b frees its slot for block b + depth.
+  //
+  // Sound units are parsed straight into spectra, as with Parser::parseSoundUnit with a
+  // spectrum, so rendering only needs Atrac3Render::renderSpectrum, or
+  // Atrac3Render::renderJointStereoSpectra for joint stereo blocks, with each channel's
+  // codedSubbandMask taken from its sound unit.
+  class PipelinedParser {
+  public:
+    struct Block {
+      SoundUnit soundUnits[2]; // left and right, with gain data and parameters only
+      FloatArray spectra[2];
+      bool isValid[2] = { false, false }; // whether each sound unit parsed successfully
+      JointStereoParameters jointStereo; // joint stereo blocks only
+    };
+
+    // Start parsing on the worker threads.
+    // @param parser The parser to use from all workers. It must not collect statistics,
+    //   and must outlive this object.
+    // @param mode The stream mode
+    // @param data Stereo blocks of data, followed by kBitstreamGuardBytes readable
+    //   bytes. Must outlive this object.
+    // @param numBlocks The number of blocks in data
+    // @param numThreads Number of worker threads, at least 1
+    // @param depth Number of blocks that can be parsed ahead of the caller, at least 1
+    PipelinedParser(const Parser& parser, const Atrac3::StreamMode& mode,
+      const uint8_t* data, int numBlocks, int numThreads, int depth);
+
+    // Stop and join the workers, even if not all blocks were consumed
+    ~PipelinedParser();
+
+    PipelinedParser(const PipelinedParser&) = delete;
+    PipelinedParser& operator=(const PipelinedParser&) = delete;
+
+    // Wait until a block is parsed. Blocks must be acquired in order, and each must be
+    // released before acquiring the next. The caller may modify the block, including
+    // swapping out its spectra for other 1024-value arrays. The spectra must be all
+    // zero again when released, such as ChannelRenderState::spectrum after rendering.
+    Block& acquire(int blockIndex);
+
+    // Return a block's slot to the workers
+    void release(int blockIndex);
+
+  private:
+    struct Slot {
+      std::atomic<int> sequence;
+      Block block;
+    };
+
+    void runWorker();
+
+    // Spin until the slot reaches the given sequence number.
+    // @return Whether reached, or false if stopping
+    bool waitForSequence(const Slot& slot, int sequence) const;
+
+    const Parser& _parser;
+    int _bytesPerStereoBlock;
+    bool _isJointStereo;
+    const uint8_t* _data;
+    int _numBlocks;
+    int _depth;
+
+    std::unique_ptr<Slot[]> _slots;
+    std::atomic<int> _nextBlockToParse;
+    std::atomic<bool> _isStopping;
+    std::vector<std::thread> _workers;
+  };
+
+}
@@ -1,5 +1,8 @@
 #include "AtracRender.h"
+#include "AtracConstantTables.h"
+#include "AtracMixKernel.h"
 #include "audio/DCT.h"
+#include <algorithm>
 #include <cmath>
 
 namespace {
@@ -7,35 +10,153 @@ namespace {
   // Utility function for rendering gain compensation. If needed, ramps gain
   // geometrically from fromGain to toGain over 8 samples starting at fromOffset.
   // Then it maintains constant toGain through (toOffset-1).
+  // Each part is passed to segment(offset, numSamples, ramp, gain), with the ramp's
+  // values, or with a null ramp and the constant gain.
+  template<typename SegmentFunction>
   void rampThenConstant(
-    const FloatArray& gainLevelTable,
-    FloatArray& result,
+    const Atrac3::Atrac3Constants& constants,
       int fromOffset, int toOffset,
-      int fromGainIndex, int toGainIndex) {
+      int fromGainIndex, int toGainIndex,
+      const SegmentFunction& segment) {
     int offset = fromOffset;
-  
+
     if (fromGainIndex != toGainIndex && fromOffset < toOffset) {
-      const int deltaIndex = fromGainIndex - toGainIndex;
-      const float multiplier = std::powf(2.0f, (float)deltaIndex/8); // TODO: put another table in the constants for performance?
-      const float fromGain = gainLevelTable[fromGainIndex];
-      float gain = fromGain;
-      for (int i=0; i<8; ++i) {
-        result[offset++] = gain;
-        gain *= multiplier;
+      segment(offset, Atrac3::kNumGainCompensationRampSamples,
+        constants.getGainCompensationRamp(fromGainIndex, toGainIndex), 0.0f);
+      offset += Atrac3::kNumGainCompensationRampSamples;
+    }
+    if (offset < toOffset) {
+      segment(offset, toOffset - offset, nullptr,
+        constants.gainCompensationLevelTable[toGainIndex]);
+    }
+  }
+
+  // Pass each segment of the gain compensation curve of a non-empty array of gain points
+  // to segment(), as rampThenConstant. Every location is on an 8-sample boundary, so
+  // every segment is a multiple of 8 samples. Together they cover the whole curve, but
+  // if the locations aren't in order, later segments overlap earlier ones and replace
+  // their values.
+  template<typename SegmentFunction>
+  void forEachGainSegment(
+      const Atrac3::Atrac3Constants& constants,
+      const Atrac3Frame::GainDataPointArray& gainPoints,
+      const SegmentFunction& segment) {
+    // Maintain constant gain to each control point, then ramp over 8 samples to the
+    // next gain value, repeat until the end of the buffer.
+    int offset = 0;
+    int gainIndex = gainPoints[0].levelCode;
+    for (const auto& p : gainPoints) {
+      const int toOffset = p.locationCode * 8;
+      const int toGainIndex = p.levelCode;
+      rampThenConstant(constants, offset, toOffset, gainIndex, toGainIndex, segment);
+      offset = toOffset;
+      gainIndex = toGainIndex;
+    }
+    // Interpolate back to normalized scale to the final sample of this block
+    rampThenConstant(constants, offset, Atrac3::kNumSamplesPerGainCompensation,
+      gainIndex, Atrac3::kGainCompensationNormalizedLevel, segment);
+  }
+
+  // Set the values of the QMF subbands in a mask to zero
+  void clearSubbands(FloatArray& spectrum, uint8_t subbandMask) {
+    for (int bandIndex=0; bandIndex<Atrac3::kNumSubbands; ++bandIndex) {
+      if ((subbandMask >> bandIndex) & 0x1) {
+        std::fill_n(&spectrum[bandIndex * Atrac3::kNumFrequenciesPerSubband],
+          Atrac3::kNumFrequenciesPerSubband, 0.0f);
       }
     }
-    const float toGain = gainLevelTable[toGainIndex];
-    while (offset < toOffset) {
-      result[offset++] = toGain;
+  }
+
+  // Set the QMF subbands of a mask in target to those of source times scale, and
+  // leave the others unchanged
+  void copySubbands(const FloatArray& source, FloatArray& target, uint8_t subbandMask,
+      float scale) {
+    for (int bandIndex=0; bandIndex<Atrac3::kNumSubbands; ++bandIndex) {
+      if ((subbandMask >> bandIndex) & 0x1) {
+        const int offset = bandIndex * Atrac3::kNumFrequenciesPerSubband;
+        for (int i=offset; i<offset + Atrac3::kNumFrequenciesPerSubband; ++i) {
+          target[i] = source[i] * scale;
+        }
+      }
+    }
+  }
+
+  // Joint stereo parameter changes between blocks interpolate over this many samples
+  constexpr int kNumJointStereoInterpolationSamples = 8;
+  constexpr float kJointStereoInterpolationStep = 1.0f / kNumJointStereoInterpolationSamples;
+
+  // Joint stereo matrices per selector, as {first from first, first from second,
+  // second from first, second from second}. Selectors 0, 1 and 3 are the same as their
+  // interpolation coefficients; selector 2 takes the sum and difference, like 3.
+  constexpr float kJointStereoMatrices[4][4] = {
+    { 0.0f, 2.0f, 2.0f, -2.0f },
+    { 2.0f, 2.0f, 0.0f, -2.0f },
+    { 1.0f, 1.0f, 1.0f, -1.0f },
+    { 1.0f, 1.0f, 1.0f, -1.0f },
+  };
+
+  // Reconstruct the samples of one QMF band of a joint stereo pair in place
+  void reverseMatrixing(const FloatArray& coefficients, float* first, float* second,
+      int numSamples, int prevSelector, int currSelector) {
+    int i = 0;
+    if (prevSelector != currSelector) {
+      const float* prev = &coefficients[prevSelector * 2];
+      const float* curr = &coefficients[currSelector * 2];
+      for (; i<kNumJointStereoInterpolationSamples; ++i) {
+        const float t = i * kJointStereoInterpolationStep;
+        const float c1 = first[i];
+        const float c2 = second[i];
+        const float mixed = c1 * (prev[0] + t * (curr[0] - prev[0])) +
+          c2 * (prev[1] + t * (curr[1] - prev[1]));
+        first[i] = mixed;
+        second[i] = c1 * 2.0f - mixed;
+      }
+    }
+
+    // The same matrix for the rest of the band, in a loop without branches that
+    // compilers vectorize
+    const float* m = kJointStereoMatrices[currSelector];
+    const float m00 = m[0], m01 = m[1], m10 = m[2], m11 = m[3];
+    for (; i<numSamples; ++i) {
+      const float c1 = first[i];
+      const float c2 = second[i];
+      first[i] = m00 * c1 + m01 * c2;
+      second[i] = m10 * c1 + m11 * c2;
+    }
+  }
+
+  // The weights of the first and second channel for a block's parameters
+  void getChannelWeights(const Atrac3Frame::JointStereoParameters& parameters, float weights[2]) {
+    constexpr int kEqualWeightIndex = 7;
+    if (parameters.weightIndex == kEqualWeightIndex) {
+      weights[0] = weights[1] = 1.0f;
+      return;
+    }
+    weights[0] = parameters.weightIndex / 7.0f;
+    weights[1] = std::sqrt(2.0f - weights[0] * weights[0]);
+    if (parameters.swapWeights) {
+      std::swap(weights[0], weights[1]);
+    }
+  }
+
+  // Scale samples by toWeight, interpolating from fromWeight over the first samples
+  void applyChannelWeight(float* samples, int numSamples, float fromWeight, float toWeight) {
+    int i = 0;
+    for (; i<kNumJointStereoInterpolationSamples; ++i) {
+      samples[i] *= fromWeight + i * kJointStereoInterpolationStep * (toWeight - fromWeight);
+    }
+    for (; i<numSamples; ++i) {
+      samples[i] *= toWeight;
     }
   }
 }
 
 namespace Atrac3Render {
 
-  void accumulateSpectrum(FloatArray& targetSpectrum, const std::vector<Atrac3Frame::TonalComponentGroup>& tonalGroups) {
+  void accumulateSpectrum(FloatArray& targetSpectrum, const Atrac3Frame::TonalComponentGroupArray& tonalGroups,
+      const Atrac3Frame::SoundUnit& soundUnit) {
     for (const auto& group : tonalGroups) {
-      accumulateSpectrum(targetSpectrum, group.childComponents);
+      accumulateSpectrum(targetSpectrum, group.childComponents, soundUnit);
     }
   }
 
@@ -61,27 +182,18 @@ namespace Atrac3Render {
       return true;
     }
   
-    // Start calculating gain control. Maintain constant gain to each control point, then
-    // ramp over 8 samples to the next gain value, repeat until the end of the buffer.
-    int offset = 0;
-    int gainIndex = gainPoints[0].levelCode;
-    for (const auto& p : gainPoints) {
-      const int toOffset = p.locationCode * 8;
-      const int toGainIndex = p.levelCode;
-      rampThenConstant(constants.gainCompensationLevelTable,
-        resultCurve, offset, toOffset, gainIndex, toGainIndex);
-      offset = toOffset;
-      gainIndex = toGainIndex;
-    }
-    // Interpolate back to normalized scale to the final sample of this block
-    rampThenConstant(constants.gainCompensationLevelTable,
-      resultCurve, offset, Atrac3::kNumSamplesPerGainCompensation,
-      gainIndex, Atrac3::kGainCompensationNormalizedLevel);
+    // Start calculating gain control
+    forEachGainSegment(constants, gainPoints,
+      [&resultCurve](int offset, int numSamples, const float* ramp, float gain) {
+        for (int i=0; i<numSamples; ++i) {
+          resultCurve[offset + i] = (ramp ? ramp[i] : gain);
+        }
+      });
 
     return true;
   }
 
-  int getInitialGainLevelCode(const std::vector<Atrac3Frame::GainDataPointArray>& bands, int bandIndex) {
+  int getInitialGainLevelCode(const Atrac3Frame::GainCompensationBandArray& bands, int bandIndex) {
     return ((int)bands.size() > bandIndex && !bands[bandIndex].empty() ?
       bands[bandIndex][0].levelCode :
       Atrac3::kGainCompensationNormalizedLevel);
@@ -89,54 +201,156 @@ namespace Atrac3Render {
 
   void renderSoundUnit(ChannelRenderState& state, const Atrac3Frame::SoundUnit& curr) {
     
-    // Populate the spectrum from the tonal components and spectral subbands
+    // Populate the spectrum from the tonal components and spectral subbands. Rendering
+    // the previous frame left it all zero.
+    FloatArray& spectrum = state.spectrum;
+    state.codedSubbandMask = curr.codedSubbandMask;
+    accumulateSpectrum(spectrum, curr.tonalGroups, curr);
+    accumulateSpectrum(spectrum, curr.spectralBands, curr);
+    renderSpectrum(state, curr.gainCompensationBands);
+  }
+
+  bool concealSpectrum(ChannelRenderState& state, bool isValid, ConcealmentMode mode) {
+    if (isValid) {
+      if (mode != ConcealmentMode::Mute) {
+        // Only the coded subbands, as the others are zero. The last valid spectrum keeps
+        // stale values outside its mask, which are never read.
+        copySubbands(state.spectrum, state.lastValidSpectrum, state.codedSubbandMask, 1.0f);
+        state.lastValidSubbandMask = state.codedSubbandMask;
+      }
+      state.numConsecutiveConcealed = 0;
+      return false;
+    }
+
+    // Past this many halvings, a faded spectrum is inaudible
+    constexpr int kMaxFadeSteps = 24;
+    ++state.numConsecutiveConcealed;
+    // Discard whatever the failed parse added, leaving the spectrum all zero
+    clearSubbands(state.spectrum, state.codedSubbandMask);
+    if (mode == ConcealmentMode::Repeat) {
+      copySubbands(state.lastValidSpectrum, state.spectrum, state.lastValidSubbandMask, 1.0f);
+      state.codedSubbandMask = state.lastValidSubbandMask;
+    } else if (mode == ConcealmentMode::Fade && state.numConsecutiveConcealed <= kMaxFadeSteps) {
+      const float scale = std::ldexp(1.0f, -state.numConsecutiveConcealed);
+      copySubbands(state.lastValidSpectrum, state.spectrum, state.lastValidSubbandMask, scale);
+      state.codedSubbandMask = state.lastValidSubbandMask;
+    } else {
+      state.codedSubbandMask = 0;
+    }
+    return true;
+  }
+
+  void renderSpectrum(ChannelRenderState& state,
+      const Atrac3Frame::GainCompensationBandArray& gainCompensationBands) {
+    renderSubbands(state, gainCompensationBands);
+    combineSubbands(state);
+  }
+
+  void renderSubbands(ChannelRenderState& state,
+      const Atrac3Frame::GainCompensationBandArray& gainCompensationBands) {
     FloatArray& spectrum = state.spectrum;
-    spectrum.assign(Atrac3::kNumFrequenciesInSpectrum, 0.0f);
-    accumulateSpectrum(spectrum, curr.tonalGroups);
-    accumulateSpectrum(spectrum, curr.spectralBands);
 
     // Reverse the partial spectrum for subbands 1 and 3. (This likely is to account
     // for frequency reflection across the Nyquist frequency when downsampling
     // the upper QMF bands).
     constexpr int kInputDctSize = Atrac3::kNumFrequenciesPerSubband;
+    constexpr int kNumOverlapSamples = Atrac3::kNumSamplesPerGainCompensation;
     float* spectrumSubbands[4] = {
       &spectrum[0],
       &spectrum[kInputDctSize],
       &spectrum[kInputDctSize*2],
       &spectrum[kInputDctSize*3]
     };
-    reverseArrayInPlace(spectrumSubbands[1], kInputDctSize);
-    reverseArrayInPlace(spectrumSubbands[3], kInputDctSize);
+    // Bands with no coded values (often the upper bands of quiet or band-limited
+    // material) are all zero and transform to silence, so skip their transform entirely.
+    bool isBandEmpty[Atrac3::kNumSubbands];
+    for (int bandIndex=0; bandIndex<Atrac3::kNumSubbands; ++bandIndex) {
+      isBandEmpty[bandIndex] = !((state.codedSubbandMask >> bandIndex) & 0x1);
+    }
+    state.codedSubbandMask = 0;
+    if (!isBandEmpty[1]) {
+      reverseArrayInPlace(spectrumSubbands[1], kInputDctSize);
+    }
+    if (!isBandEmpty[3]) {
+      reverseArrayInPlace(spectrumSubbands[3], kInputDctSize);
+    }
 
     // Render each QMF subband from its spectrum, and mix with the previous frame overlap
     constexpr float kDctScale = -1.0f;
+    const SubbandMixKernel mixKernel = getSubbandMixKernel();
     for (int bandIndex=0; bandIndex<Atrac3::kNumSubbands; ++bandIndex) {
       constexpr int kSubbandSize = kInputDctSize * 2;
 
       ChannelRenderState::Subband& subband = state.subbands[bandIndex];
-      // TODO: use fast DCT
-      DCT::MDCT_Inverse_Fast(spectrumSubbands[bandIndex], kInputDctSize, subband.unscaled.data(), kDctScale);
-      multiplyArrays(subband.unscaled, state.constants.decodingScalingWindow, subband.windowed);
-
-      // Calculate and apply gain compensation scaling per subband. The previous frame's gain data
-      // defines the scaling curve for its lead-out and this frame's lead-in (256 sample overlap per
-      // subband). This frame's lead-in is also constant-scaled based on its own initial gain data point.
-      float leadInScale = 1.0f;
-      renderGainControlCurve(
-        state.constants,
-        subband.prevGainData,
-        getInitialGainLevelCode(curr.gainCompensationBands, bandIndex),
-        subband.gain, leadInScale);
-      for (int i=0; i<256; ++i) {
-        subband.mix[i] = subband.gain[i] * (subband.windowed[i] * leadInScale + subband.prevWindowed[i+256]);
+      const int prevIndex = subband.prevIndex;
+      const int nextIndex = 1 - prevIndex;
+
+      // Gain compensation scaling per subband. The previous frame's gain data defines
+      // the scaling curve for its lead-out and this frame's lead-in (256 sample overlap
+      // per subband), as renderGainControlCurve renders it. This frame's lead-in is also
+      // constant-scaled based on its own initial gain data point. The curve is applied
+      // one segment at a time, and most frames have no gain data, so their curve is
+      // a single segment of constant 1.0.
+      const Atrac3Frame::GainDataPointArray& prevGainData = subband.prevGainData;
+      const int leadInLevelCode = getInitialGainLevelCode(gainCompensationBands, bandIndex);
+      const float leadInScale = state.constants.gainCompensationLevelTable[leadInLevelCode];
+
+      const float* prevOverlap = subband.overlaps[prevIndex].data();
+      float* nextOverlap = subband.overlaps[nextIndex].data();
+      float* mix = subband.mix.data();
+      if (isBandEmpty[bandIndex]) {
+        // The inverse DCT of zeros is zeros (up to their sign, which the mix can't
+        // tell apart), so only the previous frame's overlap decays into the mix, and
+        // this frame leaves no overlap. The zeros are still stored, so unscaled is
+        // always this frame's inverse DCT.
+        std::fill(subband.unscaled.begin(), subband.unscaled.end(), 0.0f);
+        if (prevGainData.empty()) {
+          std::copy_n(prevOverlap, kNumOverlapSamples, mix);
+        } else {
+          forEachGainSegment(state.constants, prevGainData,
+            [=](int offset, int numSamples, const float* ramp, float gain) {
+              for (int i=offset; i<offset + numSamples; ++i) {
+                mix[i] = (ramp ? ramp[i - offset] : gain) * prevOverlap[i];
+              }
+            });
+        }
+        std::fill_n(nextOverlap, kNumOverlapSamples, 0.0f);
+      } else {
+        // TODO: use fast DCT
+        DCT::MDCT_Inverse_Fast(spectrumSubbands[bandIndex], kInputDctSize, subband.unscaled.data(), kDctScale);
+
+        // Clear only the subbands that had values, for the next frame to add to
+        std::fill_n(spectrumSubbands[bandIndex], kInputDctSize, 0.0f);
+
+        // Window, scale, gain compensate and mix with the previous frame's overlap in
+        // one pass per gain segment, straight into the QMF input
+        const float* unscaled = subband.unscaled.data();
+        const float* window = state.constants.decodingScalingWindow.data();
+        if (prevGainData.empty()) {
+          mixKernel(unscaled, window, nullptr, 1.0f, leadInScale, prevOverlap, mix,
+            nextOverlap, kNumOverlapSamples);
+        } else {
+          forEachGainSegment(state.constants, prevGainData,
+            [=](int offset, int numSamples, const float* ramp, float gain) {
+              mixKernel(unscaled + offset, window + offset, ramp, gain, leadInScale,
+                prevOverlap + offset, mix + offset, nextOverlap + offset, numSamples);
+            });
+        }
       }
 
-      // Prepare for the next frame's calculation on this subband.
-      // The rest of this frame's calculation will use the mix buffer.
-      subband.prevWindowed = subband.windowed;
-      subband.prevGainData = curr.gainCompensationBands[bandIndex];
+      // Prepare for the next frame's calculation on this subband, whose previous slot is
+      // this frame's. The rest of this frame's calculation will use the mix buffer.
+      // Bands beyond the encoded ones have no gain data.
+      if (bandIndex < (int)gainCompensationBands.size()) {
+        subband.prevGainData = gainCompensationBands[bandIndex];
+      } else {
+        subband.prevGainData.clear();
+      }
+      subband.prevIndex = nextIndex;
     }
+  }
 
+  void combineSubbands(ChannelRenderState& state) {
     // Upsample the QMF subbands, first 256 samples of each subband.
     // Generates 1024 samples for most frames, but less for the first frame.
     constexpr int kNumSamplesPerQmfBuffer = Atrac3::kNumSamplesPerGainCompensation;
@@ -146,4 +360,46 @@ namespace Atrac3Render {
       kNumSamplesPerQmfBuffer, state.outputPcm);
   }
 
+  void renderJointStereoSpectra(ChannelRenderState& left, ChannelRenderState& right,
+      JointStereoState& jointStereo,
+      const Atrac3Frame::GainCompensationBandArray& leftGainCompensationBands,
+      const Atrac3Frame::GainCompensationBandArray& rightGainCompensationBands,
+      const Atrac3Frame::JointStereoParameters& parameters) {
+    renderSubbands(left, leftGainCompensationBands);
+    renderSubbands(right, rightGainCompensationBands);
+
+    // This block's subbands use the parameters of the two blocks before it, to
+    // interpolate from and to
+    Atrac3Frame::JointStereoParameters* history = jointStereo.history;
+    history[0] = history[1];
+    history[1] = history[2];
+    history[2] = parameters;
+    const Atrac3Frame::JointStereoParameters& from = history[0];
+    const Atrac3Frame::JointStereoParameters& to = history[1];
+
+    constexpr int kNumSamples = Atrac3::kNumSamplesPerGainCompensation;
+    for (int bandIndex=0; bandIndex<Atrac3::kNumSubbands; ++bandIndex) {
+      reverseMatrixing(left.constants.jointStereoMatrixCoefficients,
+        left.subbands[bandIndex].mix.data(), right.subbands[bandIndex].mix.data(),
+        kNumSamples, from.matrixSelectors[bandIndex], to.matrixSelectors[bandIndex]);
+    }
+
+    float fromWeights[2], toWeights[2];
+    getChannelWeights(from, fromWeights);
+    getChannelWeights(to, toWeights);
+    if (fromWeights[0] != 1.0f || fromWeights[1] != 1.0f ||
+        toWeights[0] != 1.0f || toWeights[1] != 1.0f) {
+      // The lowest band isn't weighted
+      for (int bandIndex=1; bandIndex<Atrac3::kNumSubbands; ++bandIndex) {
+        applyChannelWeight(left.subbands[bandIndex].mix.data(), kNumSamples,
+          fromWeights[0], toWeights[0]);
+        applyChannelWeight(right.subbands[bandIndex].mix.data(), kNumSamples,
+          fromWeights[1], toWeights[1]);
+      }
+    }
+
+    combineSubbands(left);
+    combineSubbands(right);
+  }
+
 }
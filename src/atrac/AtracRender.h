@@ -5,12 +5,20 @@
 
 namespace Atrac3Render {
 
+  // How to replace the spectrum of a sound unit that failed to parse. In every mode the
+  // previous frame's overlap still mixes in, so the output stays continuous.
+  enum class ConcealmentMode : uint8_t {
+    Mute, // silence, leaving only the decay of the previous frame
+    Repeat, // repeat the last valid spectrum
+    Fade, // repeat the last valid spectrum, halving it for each consecutive bad frame
+  };
+
   // State to maintain consistency for sequentially-decoded sound units of the same channel
   struct ChannelRenderState {
     ChannelRenderState() {
       qmf.init(constants.qmfHalfCoefficients, Atrac3::kQmfDecodingScale);
     }
-    Atrac3::Atrac3Constants constants;
+    const Atrac3::Atrac3Constants& constants = Atrac3::Atrac3Constants::getShared();
 
     // accumulated state
     Qmf::QuadBandUpsampler qmf;
@@ -18,37 +26,67 @@ namespace Atrac3Render {
 
     // scratch space
     struct Subband {
-      FloatArray unscaled = FloatArray(512); // inverse DCT result
-      FloatArray windowed = FloatArray(512); // inverse DCT scaled by decoding window
-      FloatArray prevWindowed = FloatArray(512); // previous frame's windowed subband
-      Atrac3Frame::GainDataPointArray prevGainData; // previous frame's gain compensation data, if any
-      FloatArray gain = FloatArray(256); // rendered gain compensation data, applies to previous and current frames
-      FloatArray mix = FloatArray(256); // gain compensated mix of windowed and prevWindowed overlap regions
+      FloatArray unscaled = FloatArray(512); // inverse DCT result, all zero if the subband had no values
+      FloatArray mix = FloatArray(256); // gain compensated mix of the windowed lead-in and the previous frame's overlap
+
+      // Only the windowed lead-out half of a frame carries over to the next. Each frame
+      // writes it to the slot the previous frame isn't using, then the slots swap, so
+      // the overlap is never copied between frames.
+      FloatArray overlaps[2] = { FloatArray(256), FloatArray(256) };
+      int prevIndex = 0; // slot of the previous frame
+      // Previous frame's gain compensation data, if any. A copy, as the caller reuses
+      // its sound units for the next frame.
+      Atrac3Frame::GainDataPointArray prevGainData;
+
+      const FloatArray& getPrevOverlap() const { return overlaps[prevIndex]; }
     };
+    // The current frame's spectrum. It is all zero between frames: renderSubbands
+    // clears each subband it transforms, so a frame only needs to add its values.
     FloatArray spectrum = FloatArray(1024);
+    // QMF subbands of the spectrum that may have values, as SoundUnit::codedSubbandMask.
+    // Only these are transformed and cleared, and rendering resets it to 0.
+    uint8_t codedSubbandMask = 0;
     std::vector<Subband> subbands = { {}, {}, {}, {}}; // default-init 4 subbands
+
+    // concealment of sound units that failed to parse
+    FloatArray lastValidSpectrum = FloatArray(1024); // only valid within lastValidSubbandMask
+    uint8_t lastValidSubbandMask = 0;
+    int numConsecutiveConcealed = 0;
   };
 
-  template<typename T>
-  void accumulateSpectrum(FloatArray& targetSpectrum, const std::vector<T>& entries) {
-    for (const T& entry : entries) {
-      int n = entry.mantissas.size();
+  // State of a joint stereo channel pair. Each block's parameters apply to the
+  // subbands rendered two blocks later, so they pass through a delay line.
+  struct JointStereoState {
+    // Parameters of the last 3 blocks, oldest first
+    Atrac3Frame::JointStereoParameters history[3];
+  };
+
+  // Add the scaled mantissas of each entry (spectral subbands or tonal components) to
+  // the spectrum, for any array type of entries
+  template<typename EntryArray>
+  void accumulateSpectrum(FloatArray& targetSpectrum, const EntryArray& entries,
+      const Atrac3Frame::SoundUnit& soundUnit) {
+    for (const auto& entry : entries) {
+      const int16_t* mantissas = soundUnit.getMantissas(entry);
+      int n = entry.numValues;
       for (int i=0; i<n; ++i) {
-        targetSpectrum[entry.startFrequency+i] += entry.mantissas[i] * entry.scaleFactor;
+        targetSpectrum[entry.startFrequency+i] += mantissas[i] * entry.scaleFactor;
       }
 
     }
   }
 
-  void accumulateSpectrum(FloatArray& targetSpectrum, const std::vector<Atrac3Frame::TonalComponentGroup>& tonalGroups);
+  void accumulateSpectrum(FloatArray& targetSpectrum, const Atrac3Frame::TonalComponentGroupArray& tonalGroups,
+    const Atrac3Frame::SoundUnit& soundUnit);
 
-  int getInitialGainLevelCode(const std::vector<Atrac3Frame::GainDataPointArray>& bands, int bandIndex);
+  int getInitialGainLevelCode(const Atrac3Frame::GainCompensationBandArray& bands, int bandIndex);
 
 
   // Calculate the gain compensation scaling curve for the overlapping portion (256 samples)
   // of 2 neighboring frames of a subband. The curve applies to the mix of the second half
   // of the previous-frame subband and the first half of the corresponding subband in the
-  // current frame (times a constant scale).
+  // current frame (times a constant scale). renderSubbands applies the same curve one
+  // segment at a time, without rendering it.
   // @param constants The static ATRAC3 constants
   // @param prevFrameGainPoints The gain data points for a given subband from the previous
   //   frame sound unit, from 0 to 7 points.
@@ -68,9 +106,50 @@ namespace Atrac3Render {
 
   // Render the current sound unit to output. This relies on rendering consecutive sound units for the same channel
   // number, since some of the rendering uses data from the previous frame.
-  // NOTE: This is assuming stereo LP2, not Joint-stereo LP4.
+  // Sound units of joint stereo blocks render in pairs with renderJointStereoSpectra instead.
   // @param state The persistent state for the given channel. The result PCM samples will be appended to `state.outputPcm`.
   // @param curr The current sound unit to process and render
   void renderSoundUnit(ChannelRenderState& state, const Atrac3Frame::SoundUnit& curr);
 
+  // Render the spectrum already in `state.spectrum` to output, as renderSoundUnit does after
+  // accumulating it. Used with Parser::parseSoundUnit when it dequantizes into the spectrum.
+  // @param state The persistent state for the given channel, with the current frame's spectrum
+  //   and its codedSubbandMask. The spectrum is modified.
+  // @param gainCompensationBands The current sound unit's gain compensation data
+  void renderSpectrum(ChannelRenderState& state,
+    const Atrac3Frame::GainCompensationBandArray& gainCompensationBands);
+
+  // Check the spectrum just parsed into `state.spectrum`, with its codedSubbandMask set
+  // from the sound unit, before rendering it. A valid spectrum is kept for concealing
+  // later frames, unless muting. An invalid one (from a sound unit that failed to parse
+  // part way) is replaced as the mode describes, along with its mask, and should be
+  // rendered with no gain compensation data.
+  // @return Whether the spectrum was concealed
+  bool concealSpectrum(ChannelRenderState& state, bool isValid, ConcealmentMode mode);
+
+  // The stages of renderSpectrum. renderSubbands transforms the spectrum into the 4 QMF
+  // subbands, gain compensated and mixed with the previous frame in each `mix` buffer,
+  // and leaves the spectrum all zero for the next frame.
+  // combineSubbands then upsamples those into output PCM samples.
+  void renderSubbands(ChannelRenderState& state,
+    const Atrac3Frame::GainCompensationBandArray& gainCompensationBands);
+  void combineSubbands(ChannelRenderState& state);
+
+  // Render a joint stereo block whose spectra are already in `left.spectrum` and
+  // `right.spectrum`, as renderSpectrum does for each channel of a dual mono block.
+  // Between the two stages, the subbands are reconstructed into left and right:
+  //   * Matrixing: per QMF band, the channels are combined by the band's matrix
+  //     selector: 0 or 1 scale one channel and combine both, 2 and 3 take their
+  //     sum and difference. The first 8 samples of a band interpolate the change
+  //     from the previous block's selector.
+  //   * Weighting: QMF bands 1-3 of each channel are scaled by the channel weights,
+  //     again interpolated over the first 8 samples.
+  // Both use the parameters of earlier blocks, through `jointStereo`.
+  // @param parameters The parameters parsed from this block
+  void renderJointStereoSpectra(ChannelRenderState& left, ChannelRenderState& right,
+    JointStereoState& jointStereo,
+    const Atrac3Frame::GainCompensationBandArray& leftGainCompensationBands,
+    const Atrac3Frame::GainCompensationBandArray& rightGainCompensationBands,
+    const Atrac3Frame::JointStereoParameters& parameters);
+
 }
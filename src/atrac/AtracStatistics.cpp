@@ -0,0 +1,112 @@
+#include "AtracStatistics.h"
+#include "util/StringUtil.h"
+
+namespace Atrac3Frame {
+
+  constexpr int DecodeStatistics::kNumTables;
+  constexpr int DecodeStatistics::kMaxCodeLength;
+
+  namespace {
+    template<size_t n>
+    std::string jsonArray(const uint64_t (&values)[n]) {
+      std::string result = "[";
+      for (size_t i=0; i<n; ++i) {
+        result += string_format("%s%llu", (i == 0 ? "" : ","), (unsigned long long)values[i]);
+      }
+      return result + "]";
+    }
+
+    std::string jsonTableUsage(const DecodeStatistics::TableUsage (&usage)[DecodeStatistics::kNumTables]) {
+      uint64_t numArrays[DecodeStatistics::kNumTables];
+      uint64_t numValues[DecodeStatistics::kNumTables];
+      uint64_t numBits[DecodeStatistics::kNumTables];
+      for (int i=0; i<DecodeStatistics::kNumTables; ++i) {
+        numArrays[i] = usage[i].numArrays;
+        numValues[i] = usage[i].numValues;
+        numBits[i] = usage[i].numBits;
+      }
+      return string_format("{\"arrays\": %s, \"values\": %s, \"bits\": %s}",
+        jsonArray(numArrays).c_str(), jsonArray(numValues).c_str(), jsonArray(numBits).c_str());
+    }
+
+    // One "category,table,index,value" row per counter
+    template<size_t n>
+    void csvRows(std::string& csv, const char* category, int table, const uint64_t (&values)[n]) {
+      for (size_t i=0; i<n; ++i) {
+        csv += string_format("%s,%s,%d,%llu\n", category,
+          (table < 0 ? "" : std::to_string(table).c_str()), (int)i,
+          (unsigned long long)values[i]);
+      }
+    }
+  }
+
+  void DecodeStatistics::reset() {
+    *this = DecodeStatistics();
+  }
+
+  const char* DecodeStatistics::getSectionName(int section) {
+    switch (section) {
+      case Header: return "header";
+      case GainCompensation: return "gain_compensation";
+      case TonalComponents: return "tonal_components";
+      case SpectralSubbands: return "spectral_subbands";
+      case Unused: return "unused";
+      default: return "unknown";
+    }
+  }
+
+  std::string DecodeStatistics::toCsv() const {
+    std::string csv = "category,table,index,value\n";
+    csv += string_format("sound_units,,0,%llu\n", (unsigned long long)numSoundUnits);
+    csv += string_format("parsed_sound_units,,0,%llu\n", (unsigned long long)numParsedSoundUnits);
+    for (int i=0; i<kNumSections; ++i) {
+      csv += string_format("section_bits_%s,,0,%llu\n", getSectionName(i),
+        (unsigned long long)sectionBits[i]);
+    }
+    csvRows(csv, "encoded_qmf_bands", -1, numEncodedQmfBands);
+    csvRows(csv, "gain_points", -1, numGainPoints);
+    csvRows(csv, "tonal_groups", -1, numTonalGroups);
+    csvRows(csv, "spectral_table_selectors", -1, spectralTableSelectors);
+    csvRows(csv, "tonal_quantization_steps", -1, tonalQuantizationSteps);
+    for (int t=0; t<kNumTables; ++t) {
+      const TableUsage* usages[2] = { &constantLengthCoded[t], &variableLengthCoded[t] };
+      const char* names[2] = { "clc", "vlc" };
+      for (int mode=0; mode<2; ++mode) {
+        csv += string_format("%s_arrays,%d,0,%llu\n", names[mode], t,
+          (unsigned long long)usages[mode]->numArrays);
+        csv += string_format("%s_values,%d,0,%llu\n", names[mode], t,
+          (unsigned long long)usages[mode]->numValues);
+        csv += string_format("%s_bits,%d,0,%llu\n", names[mode], t,
+          (unsigned long long)usages[mode]->numBits);
+      }
+      csvRows(csv, "vlc_code_lengths", t, codeLengths[t]);
+    }
+    return csv;
+  }
+
+  std::string DecodeStatistics::toJson() const {
+    std::string json = "{\n";
+    json += string_format("  \"soundUnits\": %llu,\n", (unsigned long long)numSoundUnits);
+    json += string_format("  \"parsedSoundUnits\": %llu,\n", (unsigned long long)numParsedSoundUnits);
+    json += "  \"sectionBits\": {";
+    for (int i=0; i<kNumSections; ++i) {
+      json += string_format("%s\"%s\": %llu", (i == 0 ? "" : ", "), getSectionName(i),
+        (unsigned long long)sectionBits[i]);
+    }
+    json += "},\n";
+    json += "  \"encodedQmfBands\": " + jsonArray(numEncodedQmfBands) + ",\n";
+    json += "  \"gainPoints\": " + jsonArray(numGainPoints) + ",\n";
+    json += "  \"tonalGroups\": " + jsonArray(numTonalGroups) + ",\n";
+    json += "  \"spectralTableSelectors\": " + jsonArray(spectralTableSelectors) + ",\n";
+    json += "  \"tonalQuantizationSteps\": " + jsonArray(tonalQuantizationSteps) + ",\n";
+    json += "  \"constantLengthCoded\": " + jsonTableUsage(constantLengthCoded) + ",\n";
+    json += "  \"variableLengthCoded\": " + jsonTableUsage(variableLengthCoded) + ",\n";
+    json += "  \"vlcCodeLengths\": [";
+    for (int t=0; t<kNumTables; ++t) {
+      json += (t == 0 ? "" : ", ") + jsonArray(codeLengths[t]);
+    }
+    json += "]\n}\n";
+    return json;
+  }
+
+}
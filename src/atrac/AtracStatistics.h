@@ -0,0 +1,63 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+namespace Atrac3Frame {
+
+  // Counters describing where the bits of a stream go, collected by a StatisticsParser.
+  // Useful for deciding which decode paths matter for real material.
+  // All counters are totals over every sound unit parsed since the last reset().
+  struct DecodeStatistics {
+    // Sections of a sound unit, in bitstream order
+    enum Section {
+      Header, // magic header and number of QMF bands
+      GainCompensation,
+      TonalComponents,
+      SpectralSubbands,
+      Unused, // padding after the spectral subbands, up to the end of the sound unit
+      kNumSections
+    };
+
+    static constexpr int kNumTables = 8;
+    static constexpr int kMaxCodeLength = 8;
+
+    // Usage of one table selector with one coding mode, by tonal components and
+    // spectral subbands combined
+    struct TableUsage {
+      uint64_t numArrays = 0; // tonal components and spectral subbands
+      uint64_t numValues = 0;
+      uint64_t numBits = 0;
+    };
+
+    void reset();
+
+    // Export all counters
+    std::string toCsv() const;
+    std::string toJson() const;
+
+    static const char* getSectionName(int section);
+
+    uint64_t numSoundUnits = 0;
+    uint64_t numParsedSoundUnits = 0; // without errors
+    uint64_t sectionBits[kNumSections] = {};
+
+    // Histograms of per sound unit and per QMF band counts
+    uint64_t numEncodedQmfBands[5] = {}; // indexed by count, 1 to 4
+    uint64_t numGainPoints[8] = {}; // per encoded QMF band
+    uint64_t numTonalGroups[32] = {};
+
+    // Table selector usage: index 0 is a skipped spectral subband
+    uint64_t spectralTableSelectors[kNumTables] = {};
+    uint64_t tonalQuantizationSteps[kNumTables] = {};
+
+    // Usage of each table by coding mode
+    TableUsage constantLengthCoded[kNumTables];
+    TableUsage variableLengthCoded[kNumTables];
+
+    // Number of variable length codes read from each table, by code length in bits,
+    // or under 0 for invalid codes. Each table 1 code is a pair of mantissas.
+    uint64_t codeLengths[kNumTables][kMaxCodeLength + 1] = {};
+  };
+
+}
@@ -20,7 +20,7 @@ public:
   // @return 0 or 1
   virtual int getBit() = 0;
 
-  // Get a numBits-sized unsigned integer from the stream, in MSB order
+  // Get a numBits-sized unsigned integer from the stream, in MSB order (up to 32 bits)
   // @return Unsigned value
   virtual int getBits(size_t numBits) = 0;
 
@@ -28,9 +28,35 @@ public:
   // @return Signed value
   virtual int getSignedBits(size_t numBits) = 0;
 
+  // Get numValues consecutive numBits-sized (up to 32) signed integers, as repeated
+  // getSignedBits(numBits) would, writing them to result.
+  virtual void getSignedBitFields(size_t numBits, size_t numValues, int* result) = 0;
+
   // Get the next numBits values as a numBits-sized array of booleans
   virtual std::vector<bool> getBitArray(size_t numBits) = 0;
 
+  // Get the next numBits (up to 32) values as a bitmask, without allocating. The first
+  // bit read is the lowest bit of the mask, so ((mask >> i) & 1) matches getBitArray()[i].
+  virtual uint32_t getBitMask(size_t numBits) = 0;
+
+  // Look at the next numBits (up to 32) as an unsigned value in MSB order, without
+  // consuming them. Bits past the end of the stream read as zeroes, so a table-driven
+  // decoder can always peek its full window and then skip the matched length.
+  virtual int peekBits(size_t numBits) = 0;
+
+  // Consume the next numBits without returning them. Skipping past the end of the
+  // stream is allowed; further reads then return zeroes.
+  virtual void skipBits(size_t numBits) = 0;
+
+  // Move the read position to an absolute bit offset from the start of the stream.
+  // @return Whether successful. Fails without moving if the offset is past the end.
+  virtual bool seekToBit(size_t bitOffset) = 0;
+
+  // Advance the read position to the next multiple of numBits (8 for byte alignment).
+  // @return Whether successful. Fails without moving if the aligned position would be
+  //   past the end of the stream.
+  virtual bool alignTo(size_t numBits) = 0;
+
   // Try to get a numBits-sized unsigned value, first checking whether the stream
   // has enough bits available.
   // @param numBits Size of the integer to get
@@ -39,15 +65,41 @@ public:
   virtual bool tryGetBits(size_t numBits, int& outTarget) = 0;
   virtual bool tryGetBits(size_t numBits, uint8_t& outTarget) = 0;
 
+  // @return Whether more bits have been consumed than the stream contains. Reads
+  //   past the end don't fail individually, so a parser can check this once at the end.
+  virtual bool hasOverrun() const = 0;
+
 };
 
+// Number of readable bytes that must follow the content of an UncheckedBitstreamReader
+constexpr size_t kBitstreamGuardBytes = 8;
+
 // Reads bits in MSB order first.
-class BitstreamReader : public IBitstreamReader {
+//
+// Bits are served from a 64-bit cache, which is refilled from the content a whole
+// word at a time. Use the BitstreamReader and UncheckedBitstreamReader aliases below.
+//
+// The class is final and its reads are defined inline below, so code that is
+// templated on a concrete reader (such as Atrac3Frame::Parser) calls them directly,
+// without virtual dispatch. Use IBitstreamReader for other sources.
+//
+// @param kGuardPadded Whether the content is followed by kBitstreamGuardBytes of
+//   readable memory. If so, refills always load a whole word without checking the
+//   content bounds, and reads past the end return the bits of the guard bytes
+//   (zeroes if the guard is zeroed). Otherwise refills fall back to single bytes
+//   near the end of the content, and reads past the end return zeroes.
+//   Either way, hasOverrun() tells whether more bits were consumed than exist.
+template<bool kGuardPadded>
+class BasicBitstreamReader final : public IBitstreamReader {
   public:
-    BitstreamReader(const std::vector<uint8_t>& content);
-    BitstreamReader(const uint8_t* content, size_t contentSize);
-    BitstreamReader(BitstreamReader&&) = default;
-    BitstreamReader(const BitstreamReader&) = default;
+    BasicBitstreamReader(const std::vector<uint8_t>& content);
+    BasicBitstreamReader(const uint8_t* content, size_t contentSize);
+    BasicBitstreamReader(BasicBitstreamReader&&) = default;
+    BasicBitstreamReader(const BasicBitstreamReader&) = default;
+
+    // Start reading new content from its beginning, so that one reader can be
+    // reused for a sequence of sound units without being reconstructed.
+    void reset(const uint8_t* content, size_t contentSize);
 
     size_t getByteOffset() const override;
     size_t getRemainingBits() const override;
@@ -55,15 +107,270 @@ class BitstreamReader : public IBitstreamReader {
     int getBit() override;
     int getBits(size_t numBits) override;
     int getSignedBits(size_t numBits) override;
+    void getSignedBitFields(size_t numBits, size_t numValues, int* result) override;
     std::vector<bool> getBitArray(size_t numBits) override;
+    uint32_t getBitMask(size_t numBits) override;
+
+    int peekBits(size_t numBits) override;
+    void skipBits(size_t numBits) override;
+    bool seekToBit(size_t bitOffset) override;
+    bool alignTo(size_t numBits) override;
 
     bool tryGetBits(size_t numBits, int& outTarget) override;
     bool tryGetBits(size_t numBits, uint8_t& outTarget) override;
 
+    bool hasOverrun() const override;
+
   private:
-    int getBitInternal();
+    // Top up the cache so that it holds at least 56 unread bits
+    void refill();
+    // Remove numBits from the top of the cache, which must hold at least that many
+    int consumeBits(size_t numBits);
+    // Total number of bits consumed from the stream, not counting reads past the end
+    size_t getBitReadOffset() const;
+    // Reset the cache and move to any bit offset, including past the end
+    void moveToBit(size_t bitOffset);
 
     const uint8_t* content = nullptr;
+    size_t contentSize = 0;
     size_t totalBitSize = 0;
-    size_t bitReadOffset = 0;
+
+    // Unread bits, MSB-aligned, with numCacheBits valid bits at the top
+    uint64_t cache = 0;
+    size_t numCacheBits = 0;
+    // Next content byte to be loaded into the cache
+    size_t nextByteOffset = 0;
 };
+
+// Bounds-checked reader for any content
+using BitstreamReader = BasicBitstreamReader<false>;
+
+// Reader without per-refill bounds checks. The content must be followed by
+// kBitstreamGuardBytes of readable memory, such as the next sound unit of a
+// block, or zeroes appended to the end of the data.
+using UncheckedBitstreamReader = BasicBitstreamReader<true>;
+
+// Inline implementation, so reads can be inlined into templated callers
+
+template<bool kGuardPadded>
+inline void BasicBitstreamReader<kGuardPadded>::reset(const uint8_t* content_, size_t contentSize_) {
+  content = content_;
+  contentSize = contentSize_;
+  totalBitSize = contentSize_ * 8;
+  cache = 0;
+  numCacheBits = 0;
+  nextByteOffset = 0;
+}
+
+template<bool kGuardPadded>
+inline size_t BasicBitstreamReader<kGuardPadded>::getByteOffset() const {
+  return (getBitReadOffset() / 8);
+}
+
+template<bool kGuardPadded>
+inline size_t BasicBitstreamReader<kGuardPadded>::getRemainingBits() const {
+  return (totalBitSize - getBitReadOffset());
+}
+
+template<bool kGuardPadded>
+inline bool BasicBitstreamReader<kGuardPadded>::hasRemainingBits(size_t minCount) const {
+  return (getBitReadOffset() + minCount <= totalBitSize);
+}
+
+template<bool kGuardPadded>
+inline int BasicBitstreamReader<kGuardPadded>::getBit() {
+  return getBits(1);
+}
+
+template<bool kGuardPadded>
+inline int BasicBitstreamReader<kGuardPadded>::getBits(size_t numBits) {
+  if (numBits == 0) {
+    return 0;
+  }
+  if (numCacheBits < numBits) {
+    refill();
+  }
+  return consumeBits(numBits);
+}
+
+template<bool kGuardPadded>
+inline int BasicBitstreamReader<kGuardPadded>::getSignedBits(size_t numBits) {
+  if (numBits == 0) {
+    return 0;
+  }
+  if (numCacheBits < numBits) {
+    refill();
+  }
+  // Arithmetic shift of the MSB-aligned cache sign-extends the 2's complement value
+  int result = static_cast<int>(static_cast<int64_t>(cache) >> (64 - numBits));
+  cache <<= numBits;
+  numCacheBits -= numBits;
+  return result;
+}
+
+template<bool kGuardPadded>
+inline void BasicBitstreamReader<kGuardPadded>::getSignedBitFields(
+      size_t numBits, size_t numValues, int* result) {
+  if (numBits == 0) {
+    for (size_t i=0; i<numValues; ++i) {
+      result[i] = 0;
+    }
+    return;
+  }
+  // Each refill holds at least 56 bits, so unpack every whole field in the cache
+  // with a fixed shift and sign extension per field, and no per-field refill check
+  size_t i = 0;
+  while (i < numValues) {
+    if (numCacheBits < numBits) {
+      refill();
+    }
+    size_t numFields = numCacheBits / numBits;
+    if (numFields > numValues - i) {
+      numFields = numValues - i;
+    }
+    uint64_t bits = cache;
+    int* fields = result + i;
+    for (size_t j=0; j<numFields; ++j) {
+      fields[j] = static_cast<int>(static_cast<int64_t>(bits) >> (64 - numBits));
+      bits <<= numBits;
+    }
+    cache = bits;
+    numCacheBits -= numFields * numBits;
+    i += numFields;
+  }
+}
+
+template<bool kGuardPadded>
+inline uint32_t BasicBitstreamReader<kGuardPadded>::getBitMask(size_t numBits) {
+  uint32_t bits = static_cast<uint32_t>(getBits(numBits));
+  uint32_t result = 0;
+  for (size_t i=0; i<numBits; ++i, bits >>= 1) {
+    result = (result << 1) | (bits & 0x1);
+  }
+  return result;
+}
+
+template<bool kGuardPadded>
+inline int BasicBitstreamReader<kGuardPadded>::peekBits(size_t numBits) {
+  if (numBits == 0) {
+    return 0;
+  }
+  if (numCacheBits < numBits) {
+    refill();
+  }
+  return static_cast<int>(cache >> (64 - numBits));
+}
+
+template<bool kGuardPadded>
+inline void BasicBitstreamReader<kGuardPadded>::skipBits(size_t numBits) {
+  if (numBits < numCacheBits) {
+    cache <<= numBits;
+    numCacheBits -= numBits;
+  } else {
+    moveToBit(nextByteOffset * 8 - numCacheBits + numBits);
+  }
+}
+
+template<bool kGuardPadded>
+inline bool BasicBitstreamReader<kGuardPadded>::seekToBit(size_t bitOffset) {
+  if (bitOffset > totalBitSize) {
+    return false;
+  }
+  moveToBit(bitOffset);
+  return true;
+}
+
+template<bool kGuardPadded>
+inline bool BasicBitstreamReader<kGuardPadded>::alignTo(size_t numBits) {
+  if (numBits == 0) {
+    return false;
+  }
+  size_t offset = nextByteOffset * 8 - numCacheBits;
+  size_t aligned = ((offset + numBits - 1) / numBits) * numBits;
+  if (aligned > totalBitSize) {
+    return false;
+  }
+  skipBits(aligned - offset);
+  return true;
+}
+
+template<bool kGuardPadded>
+inline bool BasicBitstreamReader<kGuardPadded>::tryGetBits(size_t numBits, int& outTarget) {
+  if (!hasRemainingBits(numBits)) {
+    return false;
+  }
+  outTarget = getBits(numBits);
+  return true;
+}
+
+template<bool kGuardPadded>
+inline bool BasicBitstreamReader<kGuardPadded>::tryGetBits(size_t numBits, uint8_t& outTarget) {
+  if (!hasRemainingBits(numBits)) {
+    return false;
+  }
+  outTarget = static_cast<uint8_t>(getBits(numBits));
+  return true;
+}
+
+template<bool kGuardPadded>
+inline void BasicBitstreamReader<kGuardPadded>::refill() {
+  if (kGuardPadded || nextByteOffset + 8 <= contentSize) {
+    // Load a whole big-endian word below the valid bits. Only the bytes that fully
+    // fit are counted as loaded; any partial byte loaded below them is the same
+    // data the next refill will load again, so OR-ing it in twice is harmless.
+    // With guard padding, loads past the end stay at the start of the guard.
+    size_t loadOffset = nextByteOffset;
+    if (kGuardPadded) {
+      loadOffset = (loadOffset < contentSize ? loadOffset : contentSize);
+    }
+    const uint8_t* p = content + loadOffset;
+    uint64_t word =
+      (static_cast<uint64_t>(p[0]) << 56) | (static_cast<uint64_t>(p[1]) << 48) |
+      (static_cast<uint64_t>(p[2]) << 40) | (static_cast<uint64_t>(p[3]) << 32) |
+      (static_cast<uint64_t>(p[4]) << 24) | (static_cast<uint64_t>(p[5]) << 16) |
+      (static_cast<uint64_t>(p[6]) << 8) | static_cast<uint64_t>(p[7]);
+    cache |= (word >> numCacheBits);
+    nextByteOffset += (63 - numCacheBits) / 8;
+    numCacheBits |= 56;
+    return;
+  }
+
+  // Near the end of the content, load single bytes, padding with zeroes
+  while (numCacheBits <= 56) {
+    uint64_t byte = (nextByteOffset < contentSize ? content[nextByteOffset] : 0);
+    cache |= (byte << (56 - numCacheBits));
+    ++nextByteOffset;
+    numCacheBits += 8;
+  }
+}
+
+template<bool kGuardPadded>
+inline int BasicBitstreamReader<kGuardPadded>::consumeBits(size_t numBits) {
+  int result = static_cast<int>(cache >> (64 - numBits));
+  cache <<= numBits;
+  numCacheBits -= numBits;
+  return result;
+}
+
+template<bool kGuardPadded>
+inline size_t BasicBitstreamReader<kGuardPadded>::getBitReadOffset() const {
+  size_t offset = nextByteOffset * 8 - numCacheBits;
+  return (offset < totalBitSize ? offset : totalBitSize);
+}
+
+template<bool kGuardPadded>
+inline bool BasicBitstreamReader<kGuardPadded>::hasOverrun() const {
+  return (nextByteOffset * 8 - numCacheBits > totalBitSize);
+}
+
+template<bool kGuardPadded>
+inline void BasicBitstreamReader<kGuardPadded>::moveToBit(size_t bitOffset) {
+  cache = 0;
+  numCacheBits = 0;
+  nextByteOffset = bitOffset / 8;
+  size_t partialBits = bitOffset % 8;
+  if (partialBits > 0) {
+    refill();
+    consumeBits(partialBits);
+  }
+}
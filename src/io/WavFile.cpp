@@ -146,7 +146,7 @@ namespace WavFileInternal {
         extraFormatSize, maxExtraFormatSize);
       if (extraFormatSize <= maxExtraFormatSize) {
         resultNumBytesRead += (2 + extraFormatSize);
-        // TODO: additional payload starts at byte 18
+        result.extraFormatData.assign(payload + 18, payload + 18 + extraFormatSize);
       }
     }
     return resultNumBytesRead;
@@ -18,6 +18,9 @@ struct WavFileInfo {
   uint32_t bytesPerSecond = 0;
   uint16_t blockAlign = 0;
 
+  // Format-specific data after the standard fmt fields, if any
+  std::vector<uint8_t> extraFormatData;
+
 };
 
 bool readWavFile(const std::string& filename, WavFileInfo& resultInfo, std::vector<uint8_t>& resultAudioData);
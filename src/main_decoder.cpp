@@ -1,11 +1,16 @@
 #include <functional>
+#include <cstdlib>
+#include <memory>
 
 #include "io/WavFile.h"
 #include "io/Bitstream.h"
+#include "io/IO.h"
 #include "atrac/AtracConstants.h"
+#include "atrac/AtracPipeline.h"
 #include "atrac/AtracRender.h"
 #include "util/Logging.h"
 #include "util/MathUtil.h"
+#include "util/StringUtil.h"
 #include "util/CommandLineOptionsParser.h"
 
 namespace {
@@ -15,68 +20,266 @@ namespace {
 struct DecoderOptions {
   std::string inputFilename;
   std::string outputFilename;
+  // Optional bitstream statistics output, JSON if the filename ends in .json, else CSV
+  std::string statisticsFilename;
+  // Optional frame index output (CSV). Only skims the stream, with no audio output.
+  std::string indexFilename;
+  // Worker threads that parse ahead of rendering, or 0 to parse on the render thread
+  int numThreads = 0;
+  // Number of blocks the workers may parse ahead
+  int pipelineDepth = 16;
+  // How to replace sound units that fail to parse
+  Atrac3Render::ConcealmentMode concealment = Atrac3Render::ConcealmentMode::Fade;
   LogLevel logLevel = LogLevel::Info;
 
   // TODO: source from stdin instead of a file?
   // TODO: optional other non-WAV output format?
 };
 
-bool isLP2WavFile(const WavFileInfo& wavInfo) {
-  return (
-    wavInfo.audioDataFormat == Atrac3::kWavFormatAtrac3 &&
-    wavInfo.bitsPerSample == 0 &&
-    wavInfo.blockAlign == Atrac3::kLP2BytesPerStereoBlock &&
-    wavInfo.bytesPerSecond == Atrac3::kLP2BytesPerSecond &&
-    wavInfo.numChannels == 2);
+// Find the ATRAC3 stream mode of a WAV file, or null if not ATRAC3 or an unknown mode.
+// Byte rates may be rounded either way, and the joint stereo flag in the ATRAC3
+// extra format data must match the mode if present.
+const Atrac3::StreamMode* findWavStreamMode(const WavFileInfo& wavInfo) {
+  if (wavInfo.audioDataFormat != Atrac3::kWavFormatAtrac3 ||
+      wavInfo.bitsPerSample != 0 ||
+      wavInfo.numChannels != 2) {
+    return nullptr;
+  }
+  const Atrac3::StreamMode* mode = Atrac3::findStreamMode(wavInfo.blockAlign);
+  if (!mode || std::abs(static_cast<int>(wavInfo.bytesPerSecond) - mode->bytesPerSecond) > 1) {
+    return nullptr;
+  }
+  constexpr size_t kCodingModeOffset = 6; // after a 1 and the samples per channel
+  const std::vector<uint8_t>& extra = wavInfo.extraFormatData;
+  if (extra.size() >= kCodingModeOffset + 2) {
+    bool isJointStereo = (IO::readUInt16(IO::Endian::Little, extra.data(), kCodingModeOffset) != 0);
+    if (isJointStereo != mode->isJointStereo) {
+      return nullptr;
+    }
+  }
+  return mode;
 }
 
-int runDecoder(const DecoderOptions& options) {
-  LogInfo(kLogCategory, "Decoding LP2 WAV file: %s", options.inputFilename.c_str());
+bool writeStatistics(const std::string& filename, const Atrac3Frame::DecodeStatistics& statistics) {
+  const std::string jsonExtension = ".json";
+  bool isJson = (filename.size() >= jsonExtension.size() &&
+    filename.compare(filename.size() - jsonExtension.size(), jsonExtension.size(), jsonExtension) == 0);
+  std::string text = (isJson ? statistics.toJson() : statistics.toCsv());
+  return IO::writeFileContents(filename, std::vector<uint8_t>(text.begin(), text.end()));
+}
 
+bool readAtracWavFile(const std::string& filename, std::vector<uint8_t>& atracData,
+    const Atrac3::StreamMode*& resultMode) {
   WavFileInfo wavInfo;
+  if (!readWavFile(filename, wavInfo, atracData)) {
+    LogError(kLogCategory, "Unable to read WAV file %s", filename.c_str());
+    return false;
+  }
+  resultMode = findWavStreamMode(wavInfo);
+  if (!resultMode) {
+    LogError(kLogCategory, "WAV file is not a supported ATRAC3 format: %s", filename.c_str());
+    return false;
+  }
+  LogInfo(kLogCategory, "ATRAC3 %s WAV file: %s", resultMode->name, filename.c_str());
+  return true;
+}
+
+// Write one CSV row of metadata per sound unit, without decoding any audio
+int runIndexer(const DecoderOptions& options) {
+  LogInfo(kLogCategory, "Indexing WAV file: %s", options.inputFilename.c_str());
   std::vector<uint8_t> atracData;
-  if (!readWavFile(options.inputFilename, wavInfo, atracData)) {
-    LogError(kLogCategory, "Unable to read WAV file %s", options.inputFilename.c_str());
+  const Atrac3::StreamMode* mode = nullptr;
+  if (!readAtracWavFile(options.inputFilename, atracData, mode)) {
     return -1;
   }
+  const int bytesPerSoundUnit = mode->bytesPerStereoBlock / 2;
 
-  if (!isLP2WavFile(wavInfo)) {
-    LogError(kLogCategory, "WAV file is not ATRAC3 LP2 format: %s", options.inputFilename.c_str());
-    return -1;
+  Atrac3Frame::Parser parser;
+  Atrac3Frame::SoundUnitSummary summary;
+  // A truncated last block is indexed as invalid, as the decoder conceals it
+  const int numCompleteBlocks = static_cast<int>(atracData.size()) / mode->bytesPerStereoBlock;
+  int numStereoBlocks = static_cast<int>((atracData.size() + mode->bytesPerStereoBlock - 1) /
+    mode->bytesPerStereoBlock);
+  if (numStereoBlocks > numCompleteBlocks) {
+    LogError(kLogCategory, "The last block is truncated (%d of %d bytes)",
+      static_cast<int>(atracData.size() % mode->bytesPerStereoBlock), mode->bytesPerStereoBlock);
   }
+  std::string csv = "block,channel,valid,qmf_bands,gain_points,tonal_groups,tonal_components,"
+    "spectral_subbands,spectral_coding_mode,table_selectors\n";
+  uint8_t reversed[Atrac3::kMaxBytesPerStereoBlock + kBitstreamGuardBytes];
+  Atrac3Frame::JointStereoParameters jointStereoParameters;
+  for (int blockIndex = 0; blockIndex < numStereoBlocks; ++blockIndex) {
+    const uint8_t* block = &atracData[blockIndex * mode->bytesPerStereoBlock];
+    for (int channel = 0; channel < 2; ++channel) {
+      bool isValid = false;
+      if (blockIndex >= numCompleteBlocks) {
+        summary = Atrac3Frame::SoundUnitSummary();
+      } else if (!mode->isJointStereo) {
+        BitstreamReader bitstream(block + channel * bytesPerSoundUnit, bytesPerSoundUnit);
+        isValid = parser.skimSoundUnit(bitstream, summary);
+      } else if (channel == 0) {
+        // The first sound unit may use the whole block
+        BitstreamReader bitstream(block, mode->bytesPerStereoBlock);
+        isValid = parser.skimSoundUnit(bitstream, summary);
+      } else {
+        int size = Atrac3Frame::Parser::reverseJointStereoSecondUnit(block,
+          mode->bytesPerStereoBlock, reversed);
+        BitstreamReader bitstream(reversed, size);
+        parser.parseJointStereoParameters(bitstream, jointStereoParameters);
+        isValid = parser.skimSoundUnit(bitstream, summary,
+          Atrac3Frame::SoundUnitHeader::JointStereoSecond);
+      }
 
-  WavWriter wavWriter;
-  if (!wavWriter.open(options.outputFilename, true, 44100)) {
-    LogError(kLogCategory, "Could not open output WAV file: %s", options.outputFilename.c_str());
+      // Per-band gain point counts and per-subband table selectors as digit strings
+      std::string gainPoints, tableSelectors;
+      for (int i=0; i<summary.numEncodedQmfBands; ++i) {
+        gainPoints += static_cast<char>('0' + summary.numGainPoints[i]);
+      }
+      for (int i=0; i<summary.numSpectralSubbands; ++i) {
+        tableSelectors += static_cast<char>('0' + summary.tableSelectors[i]);
+      }
+      csv += string_format("%d,%d,%d,%d,%s,%d,%d,%d,%d,%s\n", blockIndex, channel,
+        isValid ? 1 : 0, summary.numEncodedQmfBands, gainPoints.c_str(),
+        summary.numTonalGroups, summary.numTonalComponents, summary.numSpectralSubbands,
+        static_cast<int>(summary.spectralCodingMode), tableSelectors.c_str());
+    }
+  }
+
+  if (!IO::writeFileContents(options.indexFilename, std::vector<uint8_t>(csv.begin(), csv.end()))) {
+    LogError(kLogCategory, "Could not write index file: %s", options.indexFilename.c_str());
     return -1;
   }
-  LogInfo(kLogCategory, "Start output WAV file: %s", options.outputFilename.c_str());
-  LogInfo(kLogCategory, "Start decoding ATRAC3 data (%d bytes)", (int)atracData.size());
+  LogInfo(kLogCategory, "Wrote index of %d blocks: %s", numStereoBlocks, options.indexFilename.c_str());
+  return 0;
+}
 
-  Atrac3Frame::Parser parser;
+// Totals of decoding a stream
+struct DecodeSummary {
+  size_t numOutputSamplesPerChannel = 0;
+  int numSoundUnits = 0;
+  int numConcealedSoundUnits = 0; // failed to parse, and were concealed
+};
+
+// Parse on worker threads, ahead of rendering, or return null if the parser can't.
+// Collecting statistics isn't thread safe, so a StatisticsParser always parses on the
+// render thread.
+Atrac3Frame::PipelinedParser* createPipeline(const DecoderOptions& options,
+    const Atrac3Frame::Parser& parser, const Atrac3::StreamMode& mode,
+    const std::vector<uint8_t>& atracData, int numStereoBlocks) {
+  LogInfo(kLogCategory, "Parsing on %d threads, up to %d blocks ahead",
+    options.numThreads, options.pipelineDepth);
+  return new Atrac3Frame::PipelinedParser(parser, mode, atracData.data(),
+    numStereoBlocks, options.numThreads, options.pipelineDepth);
+}
+
+Atrac3Frame::PipelinedParser* createPipeline(const DecoderOptions& /*options*/,
+    const Atrac3Frame::StatisticsParser& /*parser*/, const Atrac3::StreamMode& /*mode*/,
+    const std::vector<uint8_t>& /*atracData*/, int /*numStereoBlocks*/) {
+  return nullptr;
+}
+
+// Decode every block of a stream to the output file. Templated on the layout,
+// so the block offsets are constants in each mode's loop, and the stereo coding
+// is chosen at compile time. Also templated on the parser, which is only a
+// StatisticsParser when collecting statistics.
+//
+// Sound units that fail to parse are concealed rather than rendered half-parsed, so
+// every block produces its samples and the output always has the full length. Blocks
+// have a fixed size, so a corrupt block never affects where the next one starts.
+template<typename Layout, typename ParserType>
+DecodeSummary decodeBlocks(const DecoderOptions& options, const ParserType& parser,
+    const Atrac3::StreamMode& mode, std::vector<uint8_t>& atracData, WavWriter& wavWriter) {
   Atrac3Render::ChannelRenderState leftChannel, rightChannel;
-  int numStereoBlocks = static_cast<int>(atracData.size()) / Atrac3::kLP2BytesPerStereoBlock;
+  Atrac3Render::ChannelRenderState* channels[2] = { &leftChannel, &rightChannel };
+  Atrac3Render::JointStereoState jointStereo;
+  // Sound units and readers are reused for every block, so the decode loop
+  // doesn't allocate. Sound units are parsed straight into each channel's
+  // spectrum, so they only keep the gain compensation data and parameters.
+  Atrac3Frame::SoundUnit soundUnits[2];
+  Atrac3Frame::JointStereoParameters jointStereoParameters;
+  const Atrac3Frame::GainCompensationBandArray noGainCompensation;
+  UncheckedBitstreamReader leftBitstream(nullptr, 0), rightBitstream(nullptr, 0);
+
+  // A truncated last block is decoded as a block of zeros, which conceals it
+  int numStereoBlocks = static_cast<int>((atracData.size() + Layout::kBytesPerStereoBlock - 1) /
+    Layout::kBytesPerStereoBlock);
+  if (atracData.size() % Layout::kBytesPerStereoBlock != 0) {
+    LogError(kLogCategory, "The last block is truncated (%d of %d bytes)",
+      static_cast<int>(atracData.size() % Layout::kBytesPerStereoBlock), Layout::kBytesPerStereoBlock);
+  }
+
+  // Zero guard bytes after the data, so every sound unit can be read without bounds
+  // checks. The parser checks once per sound unit whether it overran its data.
+  atracData.resize(numStereoBlocks * Layout::kBytesPerStereoBlock + kBitstreamGuardBytes, 0);
+
+  // Optionally parse on worker threads, ahead of rendering
+  std::unique_ptr<Atrac3Frame::PipelinedParser> pipeline;
+  if (options.numThreads > 0) {
+    pipeline.reset(createPipeline(options, parser, mode, atracData, numStereoBlocks));
+  }
 
   //numStereoBlocks = 44 * 30; // shorter clip for testing
-  size_t numOutputSamplesPerChannel = 0;
+  DecodeSummary summary;
   for (int blockIndex = 0; blockIndex < numStereoBlocks; ++blockIndex) {
-    // Left channel
-    int leftOffset = blockIndex * Atrac3::kLP2BytesPerStereoBlock;
-    BitstreamReader leftBitstream(&atracData[leftOffset], Atrac3::kLP2BytesPerSoundUnitChannel);
-    Atrac3Frame::SoundUnit leftSoundUnit;
-    parser.parseSoundUnit(leftBitstream, leftSoundUnit);
-    Atrac3Render::renderSoundUnit(leftChannel, leftSoundUnit);
-
-    // Right channel
-    int rightOffset = leftOffset + Atrac3::kLP2BytesPerSoundUnitChannel;
-    BitstreamReader rightBitstream(&atracData[rightOffset], Atrac3::kLP2BytesPerSoundUnitChannel);
-    Atrac3Frame::SoundUnit rightSoundUnit;
-    parser.parseSoundUnit(rightBitstream, rightSoundUnit);
-    Atrac3Render::renderSoundUnit(rightChannel, rightSoundUnit);
+    const int blockOffset = blockIndex * Layout::kBytesPerStereoBlock;
+    const Atrac3Frame::SoundUnit* parsed = soundUnits;
+    const Atrac3Frame::JointStereoParameters* parameters = &jointStereoParameters;
+    bool isValid[2] = { false, false };
+    if (pipeline) {
+      // Take each parsed spectrum, leaving the previous one for the workers to reuse
+      Atrac3Frame::PipelinedParser::Block& block = pipeline->acquire(blockIndex);
+      std::swap(leftChannel.spectrum, block.spectra[0]);
+      std::swap(rightChannel.spectrum, block.spectra[1]);
+      parsed = block.soundUnits;
+      parameters = &block.jointStereo;
+      isValid[0] = block.isValid[0];
+      isValid[1] = block.isValid[1];
+    } else if (Layout::kIsJointStereo) {
+      // Both channels share the block
+      float* spectra[2] = { leftChannel.spectrum.data(), rightChannel.spectrum.data() };
+      parser.parseJointStereoBlock(&atracData[blockOffset], Layout::kBytesPerStereoBlock,
+        soundUnits, spectra, jointStereoParameters, isValid);
+    } else {
+      leftBitstream.reset(&atracData[blockOffset], Layout::kBytesPerSoundUnit);
+      isValid[0] = parser.parseSoundUnit(leftBitstream, soundUnits[0],
+        leftChannel.spectrum.data());
+      rightBitstream.reset(&atracData[blockOffset + Layout::kBytesPerSoundUnit],
+        Layout::kBytesPerSoundUnit);
+      isValid[1] = parser.parseSoundUnit(rightBitstream, soundUnits[1],
+        rightChannel.spectrum.data());
+    }
+
+    // Conceal sound units that failed to parse, which render with no gain data
+    for (int channel = 0; channel < 2; ++channel) {
+      channels[channel]->codedSubbandMask = parsed[channel].codedSubbandMask;
+      if (Atrac3Render::concealSpectrum(*channels[channel], isValid[channel], options.concealment)) {
+        ++summary.numConcealedSoundUnits;
+        LogVerbose(kLogCategory, "Concealed block %d channel %d", blockIndex, channel);
+      }
+    }
+    const Atrac3Frame::GainCompensationBandArray& leftGainCompensation =
+      (isValid[0] ? parsed[0].gainCompensationBands : noGainCompensation);
+    const Atrac3Frame::GainCompensationBandArray& rightGainCompensation =
+      (isValid[1] ? parsed[1].gainCompensationBands : noGainCompensation);
+
+    if (Layout::kIsJointStereo) {
+      // The parameters come before the second sound unit's header, so they are only
+      // trusted if it parsed. Otherwise keep the previous block's.
+      Atrac3Render::renderJointStereoSpectra(leftChannel, rightChannel, jointStereo,
+        leftGainCompensation, rightGainCompensation,
+        isValid[1] ? *parameters : jointStereo.history[2]);
+    } else {
+      Atrac3Render::renderSpectrum(leftChannel, leftGainCompensation);
+      Atrac3Render::renderSpectrum(rightChannel, rightGainCompensation);
+    }
+    if (pipeline) {
+      pipeline->release(blockIndex);
+    }
+    summary.numSoundUnits += 2;
 
     // Append the interleaved stereo audio data to the output file
     wavWriter.appendFloat16StereoNonInterleaved(leftChannel.outputPcm, rightChannel.outputPcm);
-    numOutputSamplesPerChannel += leftChannel.outputPcm.size();
+    summary.numOutputSamplesPerChannel += leftChannel.outputPcm.size();
     leftChannel.outputPcm.clear();
     rightChannel.outputPcm.clear();
 
@@ -84,9 +287,79 @@ int runDecoder(const DecoderOptions& options) {
       LogVerbose(kLogCategory, "Decoded frame %d / %d", blockIndex, numStereoBlocks);
     }
   }
+  return summary;
+}
+
+// Decode a whole stream with the loop for its mode, chosen once rather than per block.
+// @return Whether the mode is supported
+template<typename ParserType>
+bool decodeStream(const DecoderOptions& options, const ParserType& parser,
+    const Atrac3::StreamMode& mode, std::vector<uint8_t>& atracData, WavWriter& wavWriter,
+    DecodeSummary& summary) {
+  using Atrac3::StreamModeId;
+  using Atrac3::StreamLayout;
+  switch (mode.id) {
+    case StreamModeId::LP2:
+      summary = decodeBlocks<StreamLayout<StreamModeId::LP2>>(
+        options, parser, mode, atracData, wavWriter);
+      return true;
+    case StreamModeId::Kbps105:
+      summary = decodeBlocks<StreamLayout<StreamModeId::Kbps105>>(
+        options, parser, mode, atracData, wavWriter);
+      return true;
+    case StreamModeId::LP4:
+      summary = decodeBlocks<StreamLayout<StreamModeId::LP4>>(
+        options, parser, mode, atracData, wavWriter);
+      return true;
+    default:
+      LogError(kLogCategory, "ATRAC3 %s is not supported yet", mode.name);
+      return false;
+  }
+}
+
+int runDecoder(const DecoderOptions& options) {
+  LogInfo(kLogCategory, "Decoding WAV file: %s", options.inputFilename.c_str());
+
+  std::vector<uint8_t> atracData;
+  const Atrac3::StreamMode* mode = nullptr;
+  if (!readAtracWavFile(options.inputFilename, atracData, mode)) {
+    return -1;
+  }
+
+  WavWriter wavWriter;
+  if (!wavWriter.open(options.outputFilename, true, 44100)) {
+    LogError(kLogCategory, "Could not open output WAV file: %s", options.outputFilename.c_str());
+    return -1;
+  }
+  LogInfo(kLogCategory, "Start output WAV file: %s", options.outputFilename.c_str());
+  LogInfo(kLogCategory, "Start decoding ATRAC3 data (%d bytes)", (int)atracData.size());
+
+  // The parser only collects statistics if asked, so the default one has no
+  // statistics code at all
+  DecodeSummary summary;
+  Atrac3Frame::DecodeStatistics statistics;
+  bool isSupported = (options.statisticsFilename.empty() ?
+    decodeStream(options, Atrac3Frame::Parser(), *mode, atracData, wavWriter, summary) :
+    decodeStream(options, Atrac3Frame::StatisticsParser(statistics), *mode, atracData,
+      wavWriter, summary));
+  if (!isSupported) {
+    return -1;
+  }
   wavWriter.close();
 
-  int durationSeconds = static_cast<int>(numOutputSamplesPerChannel / 44100);
+  if (!options.statisticsFilename.empty()) {
+    if (!writeStatistics(options.statisticsFilename, statistics)) {
+      LogError(kLogCategory, "Could not write statistics file: %s", options.statisticsFilename.c_str());
+      return -1;
+    }
+    LogInfo(kLogCategory, "Wrote statistics file: %s", options.statisticsFilename.c_str());
+  }
+
+  if (summary.numConcealedSoundUnits > 0) {
+    LogError(kLogCategory, "Concealed %d of %d sound units that failed to parse",
+      summary.numConcealedSoundUnits, summary.numSoundUnits);
+  }
+  int durationSeconds = static_cast<int>(summary.numOutputSamplesPerChannel / 44100);
   LogInfo(kLogCategory, "Done, audio file duration %d:%02d", durationSeconds/60, durationSeconds%60);
   return 0;
 }
@@ -104,8 +377,15 @@ int main(int argn, char** argv) {
 
   // Parse options from the command line
   CommandLineOptionsParser optionsParser;
-  optionsParser.add({"-i","--input"}, options.inputFilename, "Select the filename for the input file (a .wav file in ATRAC3 LP2 format)");
+  optionsParser.add({"-i","--input"}, options.inputFilename, "Select the filename for the input file (a .wav file in ATRAC3 LP2, 105kbps or LP4 format)");
   optionsParser.add({"-o","--output"}, options.outputFilename, "Select the output .wav file to write");
+  optionsParser.add({"--index"}, options.indexFilename, "Write a CSV index of per-frame metadata instead of decoding (skims the stream, much faster)");
+  optionsParser.add({"--threads"}, options.numThreads, "Parse on this many worker threads, ahead of rendering (default 0, parse while rendering)");
+  optionsParser.add({"--pipeline-depth"}, options.pipelineDepth, "With --threads, how many blocks may be parsed ahead (default 16)");
+  optionsParser.add({"--stats"}, options.statisticsFilename, "Write bitstream statistics to a file (JSON if it ends in .json, otherwise CSV)");
+  optionsParser.add({"--conceal-fade"}, [&](){options.concealment = Atrac3Render::ConcealmentMode::Fade;}, "Conceal sound units that fail to parse by fading out the last valid one (default)");
+  optionsParser.add({"--conceal-repeat"}, [&](){options.concealment = Atrac3Render::ConcealmentMode::Repeat;}, "Conceal sound units that fail to parse by repeating the last valid one");
+  optionsParser.add({"--conceal-mute"}, [&](){options.concealment = Atrac3Render::ConcealmentMode::Mute;}, "Conceal sound units that fail to parse with silence");
   optionsParser.add({"-q","--quiet"}, [&](){options.logLevel = LogLevel::None;}, "No logging");
   optionsParser.add({"--info"}, [&](){options.logLevel = LogLevel::None;}, "Info level logging (default)");
   optionsParser.add({"-v","--verbose"}, [&](){options.logLevel = LogLevel::Verbose;}, "Verbose logging");
@@ -116,6 +396,9 @@ int main(int argn, char** argv) {
   }
   logger.setLevel(options.logLevel);
 
-  // Run the decoder
+  // Run the decoder, or only index the stream
+  if (!options.indexFilename.empty()) {
+    return runIndexer(options);
+  }
   return runDecoder(options);
 }
@@ -0,0 +1,89 @@
+#include <cstdio>
+#include <string>
+
+#include "atrac/AtracConstants.h"
+#include "atrac/AtracConstantTables.h"
+
+// Generates src/atrac/AtracConstantTables.cpp on stdout, from the reference formulas
+// and Huffman entries in AtracConstants.cpp. Run via `make tables`.
+
+namespace {
+
+  // Shortest decimal that round-trips to the same float, as a float literal
+  std::string formatFloat(float value) {
+    char buffer[32];
+    snprintf(buffer, sizeof(buffer), "%.9g", value);
+    std::string result = buffer;
+    if (result.find_first_of(".e") == std::string::npos) {
+      result += ".0";
+    }
+    return result + "f";
+  }
+
+  void printFloatArray(const char* name, const char* sizeName, int n, float (*fn)(int)) {
+    printf("  const float %s[%s] = {", name, sizeName);
+    for (int i=0; i<n; ++i) {
+      printf("%s%s,", (i % 6 == 0 ? "\n    " : " "), formatFloat(fn(i)).c_str());
+    }
+    printf("\n  };\n\n");
+  }
+
+  void printHuffmanLookups(const Atrac3::Atrac3Constants& constants) {
+    printf("  const HuffmanTable::LookupEntry\n"
+      "      kHuffmanLookups[kNumHuffmanTables][1 << HuffmanTable::kMaxCodeBits] = {\n");
+    for (int t=0; t<Atrac3::kNumHuffmanTables; ++t) {
+      HuffmanTable table;
+      constants.buildHuffmanTable(t, table);
+      const HuffmanTable::LookupEntry* lookup = table.getLookup();
+      printf("    { // Table %d", t);
+      for (int i=0; i < (1 << HuffmanTable::kMaxCodeBits); ++i) {
+        printf("%s{%d,%d},", (i % 8 == 0 ? "\n      " : " "),
+          lookup[i].symbol, lookup[i].numBits);
+      }
+      printf("\n    },\n");
+    }
+    printf("  };\n\n");
+  }
+
+  void printHuffmanMultiSymbolLookups(const Atrac3::Atrac3Constants& constants) {
+    printf("  const HuffmanTable::MultiSymbolEntry\n"
+      "      kHuffmanMultiSymbolLookups[kNumMultiSymbolHuffmanTables]"
+      "[1 << HuffmanTable::kMultiSymbolBits] = {\n");
+    for (int t=1; t<=Atrac3::kNumMultiSymbolHuffmanTables; ++t) {
+      HuffmanTable table;
+      constants.buildHuffmanTable(t, table);
+      const HuffmanTable::MultiSymbolEntry* lookup = table.getMultiSymbolLookup();
+      printf("    { // Table %d", t);
+      for (int i=0; i < (1 << HuffmanTable::kMultiSymbolBits); ++i) {
+        const HuffmanTable::MultiSymbolEntry& e = lookup[i];
+        printf("%s{{%d,%d,%d,%d},%d,%d},", (i % 4 == 0 ? "\n      " : " "),
+          e.values[0], e.values[1], e.values[2], e.values[3], e.numValues, e.numBits);
+      }
+      printf("\n    },\n");
+    }
+    printf("  };\n\n");
+  }
+
+} // namespace
+
+int main(int argn, char** argv) {
+  Atrac3::Atrac3Constants constants;
+
+  printf("// Generated by src/main_generate_tables.cpp, do not edit. Run `make tables`.\n\n");
+  printf("#include \"AtracConstantTables.h\"\n\n");
+  printf("namespace Atrac3 {\n\n");
+  printFloatArray("kEncodingScalingWindow", "kNumSamplesPerSubband",
+    Atrac3::kNumSamplesPerSubband, Atrac3::Atrac3Constants::computeEncodingScalingWindow);
+  printFloatArray("kDecodingScalingWindow", "kNumSamplesPerSubband",
+    Atrac3::kNumSamplesPerSubband, Atrac3::Atrac3Constants::computeDecodingScalingWindow);
+  printFloatArray("kScaleFactors", "kNumScaleFactors",
+    Atrac3::kNumScaleFactors, Atrac3::Atrac3Constants::computeScaleFactor);
+  printFloatArray("kGainCompensationLevels", "kNumGainCompensationLevels",
+    Atrac3::kNumGainCompensationLevels, Atrac3::Atrac3Constants::computeGainCompensationLevel);
+  printFloatArray("kGainCompensationRamps", "kNumGainCompensationRampValues",
+    Atrac3::kNumGainCompensationRampValues, Atrac3::Atrac3Constants::computeGainCompensationRamp);
+  printHuffmanLookups(constants);
+  printHuffmanMultiSymbolLookups(constants);
+  printf("} // namespace Atrac3\n");
+  return 0;
+}
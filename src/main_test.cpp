@@ -3,6 +3,13 @@
 void addQmfTests(TestRunner&);
 void addDctTests(TestRunner&);
 void addFftTests(TestRunner&);
+void addBitstreamTests(TestRunner&);
+void addHuffmanTests(TestRunner&);
+void addFixedArrayTests(TestRunner&);
+void addAtracConstantsTests(TestRunner&);
+void addAtracFrameTests(TestRunner&);
+void addAtracPipelineTests(TestRunner&);
+void addAtracStatisticsTests(TestRunner&);
 void addAtracDecodeTests(TestRunner&);
 
 int main() {
@@ -10,6 +17,13 @@ int main() {
   addQmfTests(runner);
   addDctTests(runner);
   addFftTests(runner);
+  addBitstreamTests(runner);
+  addHuffmanTests(runner);
+  addFixedArrayTests(runner);
+  addAtracConstantsTests(runner);
+  addAtracFrameTests(runner);
+  addAtracPipelineTests(runner);
+  addAtracStatisticsTests(runner);
   addAtracDecodeTests(runner);
   bool ok = runner.runAll();
   return (ok ? 0 : -1);
@@ -0,0 +1,114 @@
+#include "TestRunner.h"
+#include "atrac/AtracConstants.h"
+#include "atrac/AtracConstantTables.h"
+#include "util/StringUtil.h"
+#include <cmath>
+#include <cstring>
+
+namespace {
+  // Allows for differences in the math library that generated the tables
+  constexpr float kRelativeTolerance = 0.000001f;
+
+  bool isCloseRelative(float a, float b) {
+    return std::fabs(a - b) <= kRelativeTolerance * std::fabs(b);
+  }
+
+  // The precomputed float tables should match their reference formulas
+  TestResult testPrecomputedFloatTables() {
+    Atrac3::Atrac3Constants constants;
+    struct Table {
+      const char* name;
+      const FloatArray& values;
+      float (*fn)(int);
+    };
+    Table tables[] = {
+      {"encoding window", constants.encodingScalingWindow,
+        Atrac3::Atrac3Constants::computeEncodingScalingWindow},
+      {"decoding window", constants.decodingScalingWindow,
+        Atrac3::Atrac3Constants::computeDecodingScalingWindow},
+      {"scale factors", constants.scaleFactors,
+        Atrac3::Atrac3Constants::computeScaleFactor},
+      {"gain levels", constants.gainCompensationLevelTable,
+        Atrac3::Atrac3Constants::computeGainCompensationLevel},
+      {"gain ramps", constants.gainCompensationRamps,
+        Atrac3::Atrac3Constants::computeGainCompensationRamp},
+    };
+    for (const Table& table : tables) {
+      for (size_t i=0; i<table.values.size(); ++i) {
+        if (!isCloseRelative(table.values[i], table.fn((int)i))) {
+          return string_format("%s differs at index %d", table.name, (int)i);
+        }
+      }
+    }
+    return (constants.encodingScalingWindow.size() == Atrac3::kNumSamplesPerSubband &&
+      constants.decodingScalingWindow.size() == Atrac3::kNumSamplesPerSubband &&
+      constants.scaleFactors.size() == Atrac3::kNumScaleFactors &&
+      constants.gainCompensationLevelTable.size() == Atrac3::kNumGainCompensationLevels &&
+      constants.gainCompensationRamps.size() == Atrac3::kNumGainCompensationRampValues &&
+      constants.getGainCompensationRamp(15, 0)[0] == constants.gainCompensationLevelTable[15]);
+  }
+
+  // The precomputed Huffman lookups should match tables built from the code entries
+  TestResult testPrecomputedHuffmanTables() {
+    Atrac3::Atrac3Constants constants;
+    for (int t=0; t<Atrac3::kNumHuffmanTables; ++t) {
+      HuffmanTable built;
+      constants.buildHuffmanTable(t, built);
+      const HuffmanTable& table = constants.huffmanTables[t];
+      for (int i=0; i < (1 << HuffmanTable::kMaxCodeBits); ++i) {
+        const HuffmanTable::LookupEntry& a = table.getLookup()[i];
+        const HuffmanTable::LookupEntry& b = built.getLookup()[i];
+        if (a.symbol != b.symbol || a.numBits != b.numBits) {
+          return string_format("Table %d lookup differs at %d", t, i);
+        }
+      }
+      if ((table.getMultiSymbolLookup() == nullptr) != (built.getMultiSymbolLookup() == nullptr)) {
+        return string_format("Table %d multi-symbol lookup presence differs", t);
+      }
+      for (int i=0; built.getMultiSymbolLookup() && i < (1 << HuffmanTable::kMultiSymbolBits); ++i) {
+        const HuffmanTable::MultiSymbolEntry& a = table.getMultiSymbolLookup()[i];
+        const HuffmanTable::MultiSymbolEntry& b = built.getMultiSymbolLookup()[i];
+        if (memcmp(a.values, b.values, sizeof(a.values)) != 0 ||
+            a.numValues != b.numValues || a.numBits != b.numBits) {
+          return string_format("Table %d multi-symbol lookup differs at %d", t, i);
+        }
+      }
+      if (table.getEntries().size() != built.getEntries().size()) {
+        return string_format("Table %d entries differ", t);
+      }
+    }
+    return true;
+  }
+
+  // The shared constants should be a single instance with the same tables as any other
+  TestResult testSharedConstants() {
+    const Atrac3::Atrac3Constants& shared = Atrac3::Atrac3Constants::getShared();
+    Atrac3::Atrac3Constants constants;
+    return (&shared == &Atrac3::Atrac3Constants::getShared() &&
+      shared.decodingScalingWindow == constants.decodingScalingWindow &&
+      shared.scaleFactors == constants.scaleFactors &&
+      shared.huffmanTables[3].getLookup() == constants.huffmanTables[3].getLookup());
+  }
+
+  // Stream modes should be found by block size, with matching compile-time layouts
+  TestResult testStreamModes() {
+    using Atrac3::StreamModeId;
+    const Atrac3::StreamMode* lp2 = Atrac3::findStreamMode(384);
+    const Atrac3::StreamMode* lp4 = Atrac3::findStreamMode(192);
+    static_assert(Atrac3::StreamLayout<StreamModeId::LP2>::kBytesPerSoundUnit ==
+      Atrac3::kLP2BytesPerSoundUnitChannel, "LP2 layout");
+    static_assert(Atrac3::StreamLayout<StreamModeId::Kbps105>::kBytesPerStereoBlock == 304,
+      "105kbps layout");
+    return (lp2 && lp2->id == StreamModeId::LP2 && !lp2->isJointStereo &&
+      lp4 && lp4->id == StreamModeId::LP4 && lp4->isJointStereo &&
+      Atrac3::findStreamMode(200) == nullptr);
+  }
+
+} // namespace
+
+void addAtracConstantsTests(TestRunner& runner) {
+  runner.add("precomputed float tables match formulas", testPrecomputedFloatTables);
+  runner.add("precomputed huffman tables match entries", testPrecomputedHuffmanTables);
+  runner.add("shared constants", testSharedConstants);
+  runner.add("stream modes", testStreamModes);
+}
@@ -2,6 +2,7 @@
 #include "AtracTestSchema.h"
 #include "atrac/AtracConstants.h"
 #include "atrac/AtracFrame.h"
+#include "atrac/AtracMixKernel.h"
 #include "atrac/AtracRender.h"
 
 #include "io/IO.h"
@@ -12,6 +13,8 @@
 #include "audio/DCT.h"
 #include "audio/QMF.h"
 
+#include <algorithm>
+#include <cmath>
 #include <memory>
 
 // It's unclear why we need the output scale of the inverse MDCT
@@ -50,6 +53,217 @@ namespace {
     return true;
   }
 
+  // Joint stereo reconstruction should apply each block's matrix selectors to the
+  // subbands of the following block, with the change interpolated over 8 samples
+  TestResult testJointStereoMatrixing() {
+    Atrac3Render::ChannelRenderState left, right, plainLeft, plainRight;
+    Atrac3Render::JointStereoState jointStereo;
+    Atrac3Frame::GainCompensationBandArray noGain;
+    Atrac3Frame::JointStereoParameters parameters[2];
+    std::fill_n(parameters[0].matrixSelectors, Atrac3::kNumSubbands, 0);
+
+    for (int blockIndex=0; blockIndex<2; ++blockIndex) {
+      for (int i=0; i<Atrac3::kNumFrequenciesInSpectrum; ++i) {
+        left.spectrum[i] = plainLeft.spectrum[i] = std::sin(i * 0.01f * (blockIndex + 1));
+        right.spectrum[i] = plainRight.spectrum[i] = std::cos(i * 0.03f);
+      }
+      left.codedSubbandMask = right.codedSubbandMask = 0xf;
+      plainLeft.codedSubbandMask = plainRight.codedSubbandMask = 0xf;
+      Atrac3Render::renderJointStereoSpectra(left, right, jointStereo, noGain, noGain,
+        parameters[blockIndex]);
+      Atrac3Render::renderSubbands(plainLeft, noGain);
+      Atrac3Render::renderSubbands(plainRight, noGain);
+
+      // The first block uses the initial selector 3, sum and difference. The second
+      // uses selector 0 from the first block, after interpolating.
+      for (int band=0; band<Atrac3::kNumSubbands; ++band) {
+        for (int i=(blockIndex == 0 ? 0 : 8); i<Atrac3::kNumSamplesPerGainCompensation; ++i) {
+          float c1 = plainLeft.subbands[band].mix[i];
+          float c2 = plainRight.subbands[band].mix[i];
+          float expectedLeft = (blockIndex == 0 ? c1 + c2 : c2 * 2.0f);
+          float expectedRight = (blockIndex == 0 ? c1 - c2 : (c1 - c2) * 2.0f);
+          if (std::abs(left.subbands[band].mix[i] - expectedLeft) > kTolerance ||
+              std::abs(right.subbands[band].mix[i] - expectedRight) > kTolerance) {
+            return string_format("Block %d band %d sample %d differs", blockIndex, band, i);
+          }
+        }
+      }
+      plainLeft.outputPcm.clear();
+      plainRight.outputPcm.clear();
+    }
+    if (left.outputPcm.empty() || left.outputPcm.size() != right.outputPcm.size()) {
+      return "Wrong output sizes";
+    }
+    return true;
+  }
+
+  // Invalid spectra should be replaced from the coded subbands of the last valid one,
+  // per concealment mode
+  TestResult testConcealSpectrum() {
+    using Atrac3Render::ConcealmentMode;
+    const ConcealmentMode modes[3] = { ConcealmentMode::Mute, ConcealmentMode::Repeat, ConcealmentMode::Fade };
+    constexpr int kSubbandSize = Atrac3::kNumFrequenciesPerSubband;
+    for (ConcealmentMode mode : modes) {
+      // Only subbands 0 and 2 are coded
+      Atrac3Render::ChannelRenderState state;
+      std::fill_n(&state.spectrum[0], kSubbandSize, 8.0f);
+      std::fill_n(&state.spectrum[2 * kSubbandSize], kSubbandSize, 8.0f);
+      state.codedSubbandMask = 0x5;
+      if (Atrac3Render::concealSpectrum(state, true, mode) || state.spectrum[0] != 8.0f) {
+        return "Changed a valid spectrum";
+      }
+      std::fill(state.spectrum.begin(), state.spectrum.end(), 0.0f); // rendered
+      for (int frame=1; frame<=2; ++frame) {
+        std::fill(state.spectrum.begin(), state.spectrum.end(), 100.0f); // half-parsed
+        state.codedSubbandMask = 0xf;
+        if (!Atrac3Render::concealSpectrum(state, false, mode)) {
+          return "Didn't conceal an invalid spectrum";
+        }
+        if (state.codedSubbandMask != (mode == ConcealmentMode::Mute ? 0 : 0x5)) {
+          return string_format("Wrong concealed subband mask for mode %d", static_cast<int>(mode));
+        }
+        float expected = (mode == ConcealmentMode::Mute ? 0.0f :
+          mode == ConcealmentMode::Repeat ? 8.0f :
+          (frame == 1 ? 4.0f : 2.0f));
+        int numExpected = (mode == ConcealmentMode::Mute ? Atrac3::kNumFrequenciesInSpectrum : 2 * kSubbandSize);
+        if (std::count(state.spectrum.begin(), state.spectrum.end(), expected) != numExpected ||
+            std::count(state.spectrum.begin(), state.spectrum.end(), 0.0f) !=
+              Atrac3::kNumFrequenciesInSpectrum - (expected == 0.0f ? 0 : numExpected)) {
+          return string_format("Wrong concealed spectrum for mode %d", static_cast<int>(mode));
+        }
+        std::fill(state.spectrum.begin(), state.spectrum.end(), 0.0f); // rendered
+      }
+    }
+    return true;
+  }
+
+  // A subband with an empty spectrum skips its transform, leaving only the decay of
+  // the previous frame's overlap in its mix, then silence
+  TestResult testEmptySubbands() {
+    Atrac3Render::ChannelRenderState state;
+    Atrac3Frame::GainCompensationBandArray noGain;
+    for (int i=0; i<Atrac3::kNumFrequenciesInSpectrum; ++i) {
+      state.spectrum[i] = std::sin(i * 0.05f);
+    }
+    state.codedSubbandMask = 0xf;
+    Atrac3Render::renderSpectrum(state, noGain);
+    FloatArray overlap = state.subbands[2].getPrevOverlap();
+    if (getAbsMax(state.spectrum) != 0.0f || state.codedSubbandMask != 0) {
+      return "Rendering didn't leave the spectrum clear";
+    }
+
+    // Only band 0 has data in the next frames
+    for (int frame=0; frame<2; ++frame) {
+      state.spectrum[3] = 1.0f;
+      state.codedSubbandMask = 0x1;
+      Atrac3Render::renderSpectrum(state, noGain);
+      for (int i=0; i<Atrac3::kNumSamplesPerGainCompensation; ++i) {
+        float expected = (frame == 0 ? overlap[i] : 0.0f);
+        if (state.subbands[2].mix[i] != expected) {
+          return string_format("Frame %d sample %d of an empty subband differs", frame, i);
+        }
+      }
+      if (getAbsMax(state.subbands[2].unscaled) != 0.0f) {
+        return "An empty subband kept an earlier frame's inverse DCT";
+      }
+      if (getAbsMax(state.subbands[0].mix) == 0.0f) {
+        return "Band 0 was not rendered";
+      }
+    }
+    return true;
+  }
+
+  // Every subband mix kernel available here should match the scalar one exactly, with
+  // constant gain and with a gain ramp, over the whole overlap and over spans of it
+  TestResult testSubbandMixKernels() {
+    using Atrac3Render::SimdLevel;
+    const Atrac3::Atrac3Constants& constants = Atrac3::Atrac3Constants::getShared();
+    FloatArray unscaled(512), prevOverlap(256);
+    for (int i=0; i<512; ++i) {
+      unscaled[i] = std::sin(i * 0.37f) * 1000.0f;
+    }
+    for (int i=0; i<256; ++i) {
+      prevOverlap[i] = std::cos(i * 0.11f) * 500.0f;
+    }
+    const float* ramp = constants.getGainCompensationRamp(2, 9);
+    const SimdLevel levels[] = { SimdLevel::SSE2, SimdLevel::AVX };
+    for (SimdLevel level : levels) {
+      Atrac3Render::SubbandMixKernel kernel = Atrac3Render::getSubbandMixKernel(level);
+      if (!kernel) {
+        continue;
+      }
+      // Offset, size, ramp and constant gain of each span
+      struct Span { int offset; int numSamples; const float* ramp; float gain; };
+      const Span spans[] = { {0, 256, nullptr, 1.0f}, {0, 256, nullptr, 0.25f},
+        {40, 8, ramp, 0.0f}, {120, 136, nullptr, 16.0f} };
+      for (const Span& span : spans) {
+        FloatArray expectedMix(256), expectedOverlap(256), mix(256), overlap(256);
+        Atrac3Render::getSubbandMixKernel(SimdLevel::Scalar)(unscaled.data() + span.offset,
+          constants.decodingScalingWindow.data() + span.offset, span.ramp, span.gain, 0.5f,
+          prevOverlap.data() + span.offset, expectedMix.data() + span.offset,
+          expectedOverlap.data() + span.offset, span.numSamples);
+        kernel(unscaled.data() + span.offset, constants.decodingScalingWindow.data() + span.offset,
+          span.ramp, span.gain, 0.5f, prevOverlap.data() + span.offset, mix.data() + span.offset,
+          overlap.data() + span.offset, span.numSamples);
+        if (mix != expectedMix || overlap != expectedOverlap) {
+          return string_format("Kernel %d differs over %d samples at %d", static_cast<int>(level),
+            span.numSamples, span.offset);
+        }
+      }
+    }
+    return (Atrac3Render::getSubbandMixKernel() != nullptr);
+  }
+
+  // Rendering with gain data should apply the same curve as renderGainControlCurve,
+  // whose segments include ramps both ways and locations out of order
+  TestResult testGainSegments() {
+    const Atrac3::Atrac3Constants& constants = Atrac3::Atrac3Constants::getShared();
+    Atrac3Frame::GainDataPointArray gainPoints;
+    const int points[4][2] = { {6, 3}, {2, 10}, {9, 5}, {7, 20} }; // level, location
+    for (const auto& point : points) {
+      Atrac3Frame::GainDataPoint& p = gainPoints.emplace_back();
+      p.levelCode = point[0];
+      p.locationCode = point[1];
+    }
+    Atrac3Frame::GainCompensationBandArray noGain, prevGain;
+    prevGain.resize(2);
+    prevGain[0] = gainPoints;
+    prevGain[1] = gainPoints;
+
+    // Frame 1 leaves overlaps with gain data for frame 2
+    Atrac3Render::ChannelRenderState state;
+    for (int i=0; i<2 * Atrac3::kNumFrequenciesPerSubband; ++i) {
+      state.spectrum[i] = std::sin(i * 0.05f);
+    }
+    state.codedSubbandMask = 0x3;
+    Atrac3Render::renderSubbands(state, prevGain);
+    FloatArray prevOverlaps[2] = { state.subbands[0].getPrevOverlap(),
+      state.subbands[1].getPrevOverlap() };
+
+    // In frame 2, only subband 1 has values
+    for (int i=0; i<Atrac3::kNumFrequenciesPerSubband; ++i) {
+      state.spectrum[Atrac3::kNumFrequenciesPerSubband + i] = std::cos(i * 0.07f);
+    }
+    state.codedSubbandMask = 0x2;
+    Atrac3Render::renderSubbands(state, noGain);
+    FloatArray curve(Atrac3::kNumSamplesPerGainCompensation);
+    float leadInScale = 0.0f;
+    Atrac3Render::renderGainControlCurve(constants, gainPoints,
+      Atrac3::kGainCompensationNormalizedLevel, curve, leadInScale);
+    const FloatArray& unscaled = state.subbands[1].unscaled;
+    const FloatArray& window = constants.decodingScalingWindow;
+    for (int i=0; i<Atrac3::kNumSamplesPerGainCompensation; ++i) {
+      if (state.subbands[0].mix[i] != curve[i] * prevOverlaps[0][i]) {
+        return string_format("Sample %d of the empty subband's mix differs", i);
+      }
+      if (state.subbands[1].mix[i] !=
+          curve[i] * (unscaled[i] * window[i] * leadInScale + prevOverlaps[1][i])) {
+        return string_format("Sample %d of the coded subband's mix differs", i);
+      }
+    }
+    return true;
+  }
+
   // Given known audio decoding data, ensure that our inverse MDCT
   // output matches the reference decoder, including scale, sign,
   // and subband frequency reversal
@@ -155,8 +369,8 @@ namespace {
       // Build the spectrum from the sound unit
       FloatArray spectrum;
       spectrum.assign(1024, 0.0f);
-      Atrac3Render::accumulateSpectrum(spectrum, su.tonalGroups);
-      Atrac3Render::accumulateSpectrum(spectrum, su.spectralBands);
+      Atrac3Render::accumulateSpectrum(spectrum, su.tonalGroups, su);
+      Atrac3Render::accumulateSpectrum(spectrum, su.spectralBands, su);
       // Check correctness
       constexpr float kTolerance = 0.0001f;
       if (!isClose(spectrum, channel.spectrum, kTolerance)) {
@@ -340,11 +554,19 @@ namespace {
     const FloatArray& expectedImdct = currFrame.channels[0].bands[0].imdct;
     const FloatArray& actualImdct = channelRenderState.subbands[0].unscaled;
     const FloatArray& expectedWindowed = currFrame.channels[0].bands[0].imdctWindowed;
-    const FloatArray& actualWindowed = channelRenderState.subbands[0].windowed;
+    FloatArray actualWindowed;
+    multiplyArrays(actualImdct, channelRenderState.constants.decodingScalingWindow, actualWindowed);
     float windowError = getMaxDifference(expectedWindowed, actualWindowed);
 
-    const FloatArray& expectedGain = currFrame.channels[0].bands[0].gainScale;
-    const FloatArray& actualGain = channelRenderState.subbands[0].gain;
+    // Rendering applies the gain curve without keeping it, so render the curve that the
+    // next frame applies to this frame's lead-out
+    const FloatArray& expectedGain = nextFrame.channels[0].bands[0].gainScale;
+    FloatArray actualGain(Atrac3::kNumSamplesPerGainCompensation);
+    float leadInScale = 0.0f;
+    Atrac3Render::renderGainControlCurve(channelRenderState.constants,
+      currSoundUnit.gainCompensationBands[0],
+      Atrac3Render::getInitialGainLevelCode(nextSoundUnit.gainCompensationBands, 0),
+      actualGain, leadInScale);
     if (!isClose(expectedGain, actualGain, 0.001f)) {
       printf("frame %d gain window mismatch:\n", frameIndex);
       printArray("expected", expectedGain);
@@ -393,10 +615,12 @@ namespace {
     printDifference("imdct2", frameIndex, channelRenderState.subbands[2].unscaled, ch.bands[2].imdct);
     printDifference("imdct3", frameIndex, channelRenderState.subbands[3].unscaled, ch.bands[3].imdct);
 
-    printDifference("win0", frameIndex, channelRenderState.subbands[0].windowed, ch.bands[0].imdctWindowed);
-    printDifference("win1", frameIndex, channelRenderState.subbands[1].windowed, ch.bands[1].imdctWindowed);
-    printDifference("win2", frameIndex, channelRenderState.subbands[2].windowed, ch.bands[2].imdctWindowed);
-    printDifference("win3", frameIndex, channelRenderState.subbands[3].windowed, ch.bands[3].imdctWindowed);
+    for (int band=0; band<Atrac3::kNumSubbands; ++band) {
+      FloatArray windowed;
+      multiplyArrays(channelRenderState.subbands[band].unscaled,
+        channelRenderState.constants.decodingScalingWindow, windowed);
+      printDifference(string_format("win%d", band).c_str(), frameIndex, windowed, ch.bands[band].imdctWindowed);
+    }
 
     printDifference("mix0", frameIndex, channelRenderState.subbands[0].mix, ch.bands[0].gainMixOverlap);
     printDifference("mix1", frameIndex, channelRenderState.subbands[1].mix, ch.bands[1].gainMixOverlap);
@@ -474,6 +698,11 @@ namespace {
 // to a JSON file from an instrumented reference decoder.
 void addAtracDecodeTests(TestRunner& runner) {
   runner.add("atrac constants deallocation", createAtracConstants);
+  runner.add("joint stereo matrixing", testJointStereoMatrixing);
+  runner.add("conceal invalid spectra", testConcealSpectrum);
+  runner.add("empty subbands skip the transform", testEmptySubbands);
+  runner.add("subband mix kernels match", testSubbandMixKernels);
+  runner.add("gain compensation segments match the curve", testGainSegments);
   runner.add("read atrac json data", loadTestDataJson);
   runner.add("spectrum imdct should match expected value", testDecodeInverseMdct);
   runner.add("decode scaling window should match expected curve", testDecodeScalingWindow);
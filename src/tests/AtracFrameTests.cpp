@@ -0,0 +1,302 @@
+#include "TestRunner.h"
+#include "BitWriter.h"
+#include "atrac/AtracFrame.h"
+#include "atrac/AtracRender.h"
+#include <algorithm>
+
+namespace {
+
+  // A sound unit with 2 bands, gain data, one tonal group and constant length coding
+  std::vector<uint8_t> makeLargeSoundUnit() {
+    BitWriter w;
+    w.write(Atrac3::kMagicHeaderLP2, 6);
+    w.write(2-1, 2); // 2 QMF bands
+    w.write(1, 3); w.write(3, 4); w.write(5, 5); // band 0: 1 gain point
+    w.write(0, 3); // band 1: no gain points
+
+    w.write(1, 5); // 1 tonal group
+    w.write(Atrac3Frame::ConstantLengthCoded, 2);
+    w.write(1, 1); w.write(0, 1); // only band 0 has components
+    w.write(2-1, 3); // 2 values per component
+    w.write(3, 3); // quantization step 3, 3 bits per value
+    w.write(1, 3); // 1 component in bin 0
+    w.write(10, 6); w.write(4, 6); // scale factor, position
+    w.write(1, 3); w.write(-2, 3);
+    w.write(0, 3); w.write(0, 3); w.write(0, 3); // no components in bins 1 to 3
+
+    w.write(3-1, 5); // 3 spectral subbands
+    w.write(Atrac3Frame::ConstantLengthCoded, 1);
+    w.write(2, 3); w.write(0, 3); w.write(3, 3); // table selectors
+    w.write(20, 6); w.write(30, 6); // scale factors of the coded subbands
+    for (int i=0; i<16; ++i) {
+      w.write(i % 7 - 3, 3);
+    }
+    w.bytes.resize(Atrac3::kLP2BytesPerSoundUnitChannel, 0);
+    return w.bytes;
+  }
+
+  // A sound unit with 1 band, no gain data or tonal groups, and variable length coding.
+  // Writes the 2 bit header of second joint stereo sound units if jointStereoParameters is
+  // set, after those parameters.
+  std::vector<uint8_t> makeSmallSoundUnit(
+      const Atrac3Frame::JointStereoParameters* jointStereoParameters = nullptr) {
+    BitWriter w;
+    if (jointStereoParameters) {
+      w.write(jointStereoParameters->swapWeights, 1);
+      w.write(jointStereoParameters->weightIndex, 3);
+      for (uint8_t selector : jointStereoParameters->matrixSelectors) {
+        w.write(selector, 2);
+      }
+      w.write(Atrac3::kJointStereoSecondUnitId, 2);
+    } else {
+      w.write(Atrac3::kMagicHeaderLP2, 6);
+    }
+    w.write(1-1, 2); // 1 QMF band
+    w.write(0, 3); // no gain points
+    w.write(0, 5); // no tonal groups
+    w.write(1-1, 5); // 1 spectral subband
+    w.write(Atrac3Frame::VariableLengthCoded, 1);
+    w.write(2, 3); // table selector
+    w.write(5, 6); // scale factor
+    for (int i=0; i<8; ++i) {
+      w.write(i == 3 ? 4 : 0, i == 3 ? 3 : 1); // table 2 codes: "100" is 1, "0" is 0
+    }
+    w.bytes.resize(Atrac3::kLP2BytesPerSoundUnitChannel, 0);
+    return w.bytes;
+  }
+
+  bool isSameSoundUnit(const Atrac3Frame::SoundUnit& a, const Atrac3Frame::SoundUnit& b) {
+    if (a.gainCompensationBands.size() != b.gainCompensationBands.size() ||
+        a.tonalGroups.size() != b.tonalGroups.size() ||
+        a.spectralBands.size() != b.spectralBands.size()) {
+      return false;
+    }
+    for (size_t i=0; i<a.gainCompensationBands.size(); ++i) {
+      const Atrac3Frame::GainDataPointArray& pa = a.gainCompensationBands[i];
+      const Atrac3Frame::GainDataPointArray& pb = b.gainCompensationBands[i];
+      if (pa.size() != pb.size()) {
+        return false;
+      }
+      for (size_t j=0; j<pa.size(); ++j) {
+        if (pa[j].levelCode != pb[j].levelCode || pa[j].locationCode != pb[j].locationCode) {
+          return false;
+        }
+      }
+    }
+    for (size_t i=0; i<a.spectralBands.size(); ++i) {
+      const Atrac3Frame::SpectralSubband& sa = a.spectralBands[i];
+      const Atrac3Frame::SpectralSubband& sb = b.spectralBands[i];
+      if (sa.tableSelector != sb.tableSelector || sa.scaleFactor != sb.scaleFactor ||
+          sa.numValues != sb.numValues) {
+        return false;
+      }
+      for (int j=0; j<sa.numValues; ++j) {
+        if (a.getMantissas(sa)[j] != b.getMantissas(sb)[j]) {
+          return false;
+        }
+      }
+    }
+    return true;
+  }
+
+  TestResult testParseSoundUnit() {
+    std::vector<uint8_t> bytes = makeLargeSoundUnit();
+    BitstreamReader bitstream(bytes);
+    Atrac3Frame::Parser parser;
+    Atrac3Frame::SoundUnit su;
+    if (!parser.parseSoundUnit(bitstream, su)) {
+      return "Failed to parse";
+    }
+    if (su.gainCompensationBands.size() != 2 || su.gainCompensationBands[0].size() != 1 ||
+        su.gainCompensationBands[0][0].locationCode != 5 || !su.gainCompensationBands[1].empty()) {
+      return "Wrong gain data";
+    }
+    if (su.tonalGroups.size() != 1 || su.tonalGroups[0].childComponents.size() != 1) {
+      return "Wrong tonal groups";
+    }
+    const Atrac3Frame::TonalComponent& component = su.tonalGroups[0].childComponents[0];
+    if (component.startFrequency != 4 || component.numValues != 2 ||
+        su.getMantissas(component)[0] != 1 || su.getMantissas(component)[1] != -2) {
+      return "Wrong tonal component";
+    }
+    if (su.spectralBands.size() != 3 || su.getMantissas(su.spectralBands[0])[0] != -3 ||
+        su.getMantissas(su.spectralBands[1])[0] != 0 || su.getMantissas(su.spectralBands[2])[0] != -2) {
+      return "Wrong spectral subbands";
+    }
+    // Mantissas are pooled in parse order: tonal values, then each spectral subband
+    if (su.mantissas.size() != 2 + 3*8 || component.mantissaOffset != 0 ||
+        su.spectralBands[2].mantissaOffset != 2 + 2*8) {
+      return "Wrong mantissa pool layout";
+    }
+    return true;
+  }
+
+  // Parsing into a previously used sound unit should give the same result as
+  // parsing into a new one, with nothing left over from the previous parse
+  TestResult testParseIntoExistingSoundUnit() {
+    std::vector<uint8_t> largeBytes = makeLargeSoundUnit();
+    std::vector<uint8_t> smallBytes = makeSmallSoundUnit();
+    Atrac3Frame::Parser parser;
+
+    Atrac3Frame::SoundUnit reused;
+    BitstreamReader bitstream(largeBytes);
+    if (!parser.parseSoundUnit(bitstream, reused)) {
+      return "Failed to parse the large sound unit";
+    }
+    bitstream.reset(smallBytes.data(), smallBytes.size());
+    if (!parser.parseSoundUnit(bitstream, reused)) {
+      return "Failed to parse the small sound unit after reset";
+    }
+
+    Atrac3Frame::SoundUnit fresh;
+    BitstreamReader freshBitstream(smallBytes);
+    parser.parseSoundUnit(freshBitstream, fresh);
+    if (!isSameSoundUnit(reused, fresh) || !reused.tonalGroups.empty() ||
+        reused.getMantissas(reused.spectralBands[0])[3] != 1 ||
+        reused.mantissas.size() != fresh.mantissas.size()) {
+      return "Reused sound unit differs from a new one";
+    }
+    return true;
+  }
+
+  // Parsing straight into a spectrum should give exactly the spectrum the renderer
+  // accumulates from a structured parse
+  TestResult testParseIntoSpectrum() {
+    Atrac3Frame::Parser parser;
+    std::vector<uint8_t> units[2] = { makeLargeSoundUnit(), makeSmallSoundUnit() };
+    for (const std::vector<uint8_t>& bytes : units) {
+      Atrac3Frame::SoundUnit su;
+      BitstreamReader bitstream(bytes);
+      parser.parseSoundUnit(bitstream, su);
+      FloatArray expected(Atrac3::kNumFrequenciesInSpectrum, 0.0f);
+      Atrac3Render::accumulateSpectrum(expected, su.tonalGroups, su);
+      Atrac3Render::accumulateSpectrum(expected, su.spectralBands, su);
+
+      Atrac3Frame::SoundUnit fusedSu;
+      FloatArray spectrum(Atrac3::kNumFrequenciesInSpectrum, 0.0f);
+      BitstreamReader fusedBitstream(bytes);
+      if (!parser.parseSoundUnit(fusedBitstream, fusedSu, spectrum.data())) {
+        return "Failed to parse into the spectrum";
+      }
+      if (spectrum != expected) {
+        return "Spectrum differs from the structured parse";
+      }
+      if (fusedSu.gainCompensationBands.size() != su.gainCompensationBands.size() ||
+          fusedSu.spectralBands.size() != su.spectralBands.size() ||
+          fusedSu.codedSubbandMask != su.codedSubbandMask || su.codedSubbandMask == 0) {
+        return "Wrong sound unit parameters";
+      }
+      // Values are only within the coded subbands
+      for (int i=0; i<Atrac3::kNumFrequenciesInSpectrum; ++i) {
+        int band = i / Atrac3::kNumFrequenciesPerSubband;
+        if (spectrum[i] != 0.0f && !((su.codedSubbandMask >> band) & 0x1)) {
+          return "Values outside the coded subbands";
+        }
+      }
+    }
+    return true;
+  }
+
+  // Skimming should find the same metadata as a full parse
+  TestResult testSkimSoundUnit() {
+    Atrac3Frame::Parser parser;
+    std::vector<uint8_t> units[2] = { makeLargeSoundUnit(), makeSmallSoundUnit() };
+    for (const std::vector<uint8_t>& bytes : units) {
+      Atrac3Frame::SoundUnit su;
+      BitstreamReader bitstream(bytes);
+      parser.parseSoundUnit(bitstream, su);
+      Atrac3Frame::SoundUnitSummary summary;
+      BitstreamReader skimBitstream(bytes);
+      if (!parser.skimSoundUnit(skimBitstream, summary)) {
+        return "Failed to skim";
+      }
+      if (summary.numEncodedQmfBands != su.gainCompensationBands.size() ||
+          summary.numTonalGroups != su.tonalGroups.size() ||
+          summary.numSpectralSubbands != su.spectralBands.size()) {
+        return "Wrong counts";
+      }
+      for (size_t i=0; i<su.gainCompensationBands.size(); ++i) {
+        if (summary.numGainPoints[i] != su.gainCompensationBands[i].size()) {
+          return "Wrong gain point counts";
+        }
+      }
+      size_t numTonalComponents = 0;
+      for (const Atrac3Frame::TonalComponentGroup& group : su.tonalGroups) {
+        numTonalComponents += group.childComponents.size();
+      }
+      if (summary.numTonalComponents != numTonalComponents) {
+        return "Wrong tonal component count";
+      }
+      for (size_t i=0; i<su.spectralBands.size(); ++i) {
+        if (summary.tableSelectors[i] != su.spectralBands[i].tableSelector) {
+          return "Wrong table selectors";
+        }
+      }
+    }
+    return true;
+  }
+
+  // A joint stereo block stores its second sound unit backwards from the end of the
+  // block, which should parse the same as a separate sound unit
+  TestResult testParseJointStereoBlock() {
+    Atrac3Frame::JointStereoParameters expectedParameters;
+    expectedParameters.swapWeights = 1;
+    expectedParameters.weightIndex = 5;
+    for (int i=0; i<Atrac3::kNumSubbands; ++i) {
+      expectedParameters.matrixSelectors[i] = static_cast<uint8_t>(i);
+    }
+    std::vector<uint8_t> first = makeLargeSoundUnit();
+    std::vector<uint8_t> second = makeSmallSoundUnit(&expectedParameters);
+    second.resize(8);
+
+    // The large sound unit takes well under half of the block. Reversed, the second
+    // sound unit follows 2 sync bytes.
+    constexpr int kBlockSize = 192;
+    std::vector<uint8_t> block(first.begin(), first.begin() + kBlockSize);
+    block[kBlockSize-1] = block[kBlockSize-2] = Atrac3::kJointStereoSyncByte;
+    std::copy(second.begin(), second.end(), block.rbegin() + 2);
+    block.resize(kBlockSize + kBitstreamGuardBytes, 0);
+
+    Atrac3Frame::Parser parser;
+    Atrac3Frame::SoundUnit soundUnits[2];
+    Atrac3Frame::JointStereoParameters parameters;
+    bool isValid[2] = { false, false };
+    if (!parser.parseJointStereoBlock(block.data(), kBlockSize, soundUnits, nullptr,
+        parameters, isValid) || !isValid[0] || !isValid[1]) {
+      return "Failed to parse";
+    }
+    if (parameters.swapWeights != 1 || parameters.weightIndex != 5 ||
+        !std::equal(parameters.matrixSelectors, parameters.matrixSelectors + Atrac3::kNumSubbands,
+          expectedParameters.matrixSelectors)) {
+      return "Wrong joint stereo parameters";
+    }
+
+    std::vector<uint8_t> units[2] = { makeLargeSoundUnit(), makeSmallSoundUnit() };
+    for (int i=0; i<2; ++i) {
+      Atrac3Frame::SoundUnit expected;
+      BitstreamReader bitstream(units[i]);
+      parser.parseSoundUnit(bitstream, expected);
+      if (!isSameSoundUnit(soundUnits[i], expected)) {
+        return "Sound unit differs from a separate parse";
+      }
+    }
+
+    // A block of only sync bytes has no second sound unit
+    std::fill(block.begin(), block.begin() + kBlockSize, Atrac3::kJointStereoSyncByte);
+    parser.parseJointStereoBlock(block.data(), kBlockSize, soundUnits, nullptr,
+      parameters, isValid);
+    if (isValid[0] || isValid[1]) {
+      return "Parsed a block of sync bytes";
+    }
+    return true;
+  }
+
+} // namespace
+
+void addAtracFrameTests(TestRunner& runner) {
+  runner.add("parse sound unit", testParseSoundUnit);
+  runner.add("parse into an existing sound unit", testParseIntoExistingSoundUnit);
+  runner.add("parse into a spectrum", testParseIntoSpectrum);
+  runner.add("skim sound unit", testSkimSoundUnit);
+  runner.add("parse joint stereo block", testParseJointStereoBlock);
+}
@@ -0,0 +1,79 @@
+#include "TestRunner.h"
+#include "TestRandom.h"
+#include "atrac/AtracPipeline.h"
+#include "util/StringUtil.h"
+#include <algorithm>
+
+namespace {
+
+  // Pseudo-random stereo blocks with valid headers, followed by guard bytes. Many
+  // sound units won't parse, which is also useful to compare.
+  std::vector<uint8_t> makeTestBlocks(int numBlocks) {
+    std::vector<uint8_t> result(numBlocks * Atrac3::kLP2BytesPerStereoBlock + kBitstreamGuardBytes, 0);
+    TestRandom random(12345);
+    for (size_t i=0; i+kBitstreamGuardBytes < result.size(); ++i) {
+      result[i] = random.nextByte();
+      if (i % Atrac3::kLP2BytesPerSoundUnitChannel == 0) {
+        // Magic header in the upper 6 bits, 1 to 4 bands in the lower 2
+        result[i] = static_cast<uint8_t>((Atrac3::kMagicHeaderLP2 << 2) | (result[i] & 0x3));
+      }
+    }
+    return result;
+  }
+
+  // Blocks parsed on worker threads should match parsing them in order, with the
+  // same reader type, as readers differ in what they read past a sound unit
+  TestResult testPipelinedParse() {
+    constexpr int kNumBlocks = 50;
+    std::vector<uint8_t> data = makeTestBlocks(kNumBlocks);
+    Atrac3Frame::Parser parser;
+    Atrac3Frame::SoundUnit soundUnit;
+    FloatArray spectrum(Atrac3::kNumFrequenciesInSpectrum);
+    int numThreads[] = { 1, 3 };
+    int depths[] = { 1, 4 };
+    for (int threads : numThreads) {
+      for (int depth : depths) {
+        Atrac3Frame::PipelinedParser pipeline(parser, Atrac3::kStreamModes[0], data.data(),
+          kNumBlocks, threads, depth);
+        for (int b=0; b<kNumBlocks; ++b) {
+          Atrac3Frame::PipelinedParser::Block& block = pipeline.acquire(b);
+          for (int channel=0; channel<2; ++channel) {
+            UncheckedBitstreamReader bitstream(&data[b * Atrac3::kLP2BytesPerStereoBlock +
+              channel * Atrac3::kLP2BytesPerSoundUnitChannel], Atrac3::kLP2BytesPerSoundUnitChannel);
+            std::fill(spectrum.begin(), spectrum.end(), 0.0f);
+            bool isValid = parser.parseSoundUnit(bitstream, soundUnit, spectrum.data());
+            if (isValid != block.isValid[channel] || spectrum != block.spectra[channel] ||
+                soundUnit.gainCompensationBands.size() !=
+                block.soundUnits[channel].gainCompensationBands.size()) {
+              return string_format("Block %d channel %d differs (%d threads, depth %d)",
+                b, channel, threads, depth);
+            }
+            std::fill(block.spectra[channel].begin(), block.spectra[channel].end(), 0.0f);
+          }
+          pipeline.release(b);
+        }
+      }
+    }
+    return true;
+  }
+
+  // Destroying the pipeline before consuming every block should stop the workers
+  TestResult testPipelineEarlyStop() {
+    constexpr int kNumBlocks = 50;
+    std::vector<uint8_t> data = makeTestBlocks(kNumBlocks);
+    Atrac3Frame::Parser parser;
+    Atrac3Frame::PipelinedParser pipeline(parser, Atrac3::kStreamModes[0], data.data(),
+      kNumBlocks, 2, 4);
+    for (int b=0; b<10; ++b) {
+      pipeline.acquire(b);
+      pipeline.release(b);
+    }
+    return true;
+  }
+
+} // namespace
+
+void addAtracPipelineTests(TestRunner& runner) {
+  runner.add("pipelined parse matches sequential parse", testPipelinedParse);
+  runner.add("pipeline early stop", testPipelineEarlyStop);
+}
@@ -0,0 +1,69 @@
+#include "TestRunner.h"
+#include "BitWriter.h"
+#include "atrac/AtracFrame.h"
+#include "atrac/AtracStatistics.h"
+#include "util/StringUtil.h"
+
+namespace {
+
+  // Every code read should count under the length of the lookup entry it consumed,
+  // including codes that the multi-symbol lookup would decode several at a time
+  TestResult testCodeLengths() {
+    const Atrac3::Atrac3Constants& constants = Atrac3::Atrac3Constants::getShared();
+    Atrac3Frame::DecodeStatistics statistics;
+    Atrac3Frame::CollectStatistics collector(statistics);
+    for (int tableIndex : {1, 2}) {
+      const HuffmanTable& table = constants.huffmanTables[tableIndex];
+      const int valuesPerSymbol = (tableIndex == 1 ? 2 : 1);
+      BitWriter writer;
+      uint64_t expected[Atrac3Frame::DecodeStatistics::kMaxCodeLength + 1] = {};
+      int numValues = 0;
+      for (int repeat=0; repeat<3; ++repeat) {
+        for (const HuffmanEntry& e : table.getEntries()) {
+          writer.write(e.code, e.numBits);
+          ++expected[e.numBits];
+          numValues += valuesPerSymbol;
+        }
+      }
+      BitstreamReader bitstream(writer.bytes);
+      std::vector<int> values(numValues);
+      if (table.readValues(bitstream, numValues, values.data(),
+          collector.getCodeLengthCounter(tableIndex)) != numValues) {
+        return string_format("Table %d failed to read its codes", tableIndex);
+      }
+      for (int n=0; n<=Atrac3Frame::DecodeStatistics::kMaxCodeLength; ++n) {
+        if (statistics.codeLengths[tableIndex][n] != expected[n]) {
+          return string_format("Table %d counted the wrong %d bit codes", tableIndex, n);
+        }
+      }
+    }
+
+    // An invalid code counts under 0
+    HuffmanTable table({{1, 0, 5}, {2, 2, 6}});
+    table.initMultiSymbol();
+    std::vector<uint8_t> bytes = {0x26, 0x00}; // 0 0 10 0 11000000 000
+    BitstreamReader bitstream(bytes);
+    int values[10] = {};
+    table.readValues(bitstream, 10, values, collector.getCodeLengthCounter(3));
+    const uint64_t* lengths = statistics.codeLengths[3];
+    return (lengths[0] == 1 && lengths[1] == 3 && lengths[2] == 1 &&
+      bitstream.getRemainingBits() == 3);
+  }
+
+  TestResult testReset() {
+    Atrac3Frame::DecodeStatistics statistics;
+    statistics.numSoundUnits = 3;
+    statistics.sectionBits[Atrac3Frame::DecodeStatistics::Unused] = 100;
+    statistics.codeLengths[2][1] = 5;
+    statistics.reset();
+    return (statistics.numSoundUnits == 0 &&
+      statistics.sectionBits[Atrac3Frame::DecodeStatistics::Unused] == 0 &&
+      statistics.codeLengths[2][1] == 0);
+  }
+
+} // namespace
+
+void addAtracStatisticsTests(TestRunner& runner) {
+  runner.add("decode statistics code lengths", testCodeLengths);
+  runner.add("decode statistics reset", testReset);
+}
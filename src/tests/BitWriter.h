@@ -0,0 +1,21 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+// MSB-first bit writer for building encoded test streams
+class BitWriter {
+public:
+  void write(int value, int numBits) {
+    for (int i=numBits-1; i>=0; --i) {
+      if (_numBits % 8 == 0) {
+        bytes.push_back(0);
+      }
+      bytes.back() |= static_cast<uint8_t>(((value >> i) & 0x1) << (7 - (_numBits % 8)));
+      ++_numBits;
+    }
+  }
+  std::vector<uint8_t> bytes;
+private:
+  size_t _numBits = 0;
+};
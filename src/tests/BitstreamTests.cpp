@@ -0,0 +1,235 @@
+#include "TestRunner.h"
+#include "TestRandom.h"
+#include "io/Bitstream.h"
+#include "util/StringUtil.h"
+
+namespace {
+
+  // Straightforward MSB-first bit lookup to compare against
+  int getReferenceBits(const std::vector<uint8_t>& bytes, size_t bitOffset, size_t numBits) {
+    int result = 0;
+    for (size_t i=0; i<numBits; ++i, ++bitOffset) {
+      int bit = 0;
+      if (bitOffset < bytes.size() * 8) {
+        bit = (bytes[bitOffset / 8] >> (7 - (bitOffset % 8))) & 0x1;
+      }
+      result = (result << 1) + bit;
+    }
+    return result;
+  }
+
+  // Reads of mixed sizes across word refills should match a bit-by-bit read
+  TestResult testMixedSizeReads() {
+    // Odd size, so the end of the content is reached with single-byte refills
+    std::vector<uint8_t> bytes = TestRandom(12345).makeBytes(197);
+    BitstreamReader bitstream(bytes);
+    size_t bitOffset = 0;
+    for (size_t i=0; bitOffset < bytes.size() * 8; ++i) {
+      size_t numBits = 1 + (i * 7) % 32;
+      int expected = getReferenceBits(bytes, bitOffset, numBits);
+      int actual = bitstream.getBits(numBits);
+      if (actual != expected) {
+        return string_format("Read %d bits at offset %d: got %d, expected %d",
+          (int)numBits, (int)bitOffset, actual, expected);
+      }
+      bitOffset += numBits;
+    }
+    return true;
+  }
+
+  // Reading past the end should produce zeroes, and the offsets should stop at the end
+  TestResult testReadPastEnd() {
+    std::vector<uint8_t> bytes = {0xff, 0xff, 0xff};
+    BitstreamReader bitstream(bytes);
+    if (bitstream.getBits(20) != 0xfffff || bitstream.getRemainingBits() != 4) {
+      return "Unexpected value or remaining bits before the end";
+    }
+    if (bitstream.getBits(8) != 0xf0) {
+      return "Partial read at the end should be zero-padded";
+    }
+    if (bitstream.getBits(32) != 0 || bitstream.getBit() != 0) {
+      return "Reads past the end should be zero";
+    }
+    if (bitstream.getRemainingBits() != 0 || bitstream.getByteOffset() != bytes.size()) {
+      return "Offsets should stop at the end of the content";
+    }
+    return true;
+  }
+
+  TestResult testSignedBits() {
+    std::vector<uint8_t> bytes = {0xb4}; // 101 101 00
+    BitstreamReader bitstream(bytes);
+    int a = bitstream.getSignedBits(3);
+    int b = bitstream.getSignedBits(3);
+    int c = bitstream.getSignedBits(2);
+    return (a == -3 && b == -3 && c == 0);
+  }
+
+  // Bulk signed fields should match one getSignedBits() per field, across refills
+  TestResult testSignedBitFields() {
+    std::vector<uint8_t> bytes = TestRandom(12345).makeBytes(160);
+    BitstreamReader bitstream(bytes);
+    BitstreamReader referenceBitstream(bytes);
+    std::vector<int> fields(400);
+    for (size_t numBits : {2, 3, 1, 6, 5, 0, 4, 7, 32}) {
+      // Misalign the start, so fields straddle cache refills differently
+      bitstream.getBits(3);
+      referenceBitstream.getBits(3);
+      size_t numValues = 7 + numBits * 11;
+      bitstream.getSignedBitFields(numBits, numValues, fields.data());
+      for (size_t i=0; i<numValues; ++i) {
+        int expected = referenceBitstream.getSignedBits(numBits);
+        if (fields[i] != expected) {
+          return string_format("%d-bit field %d: got %d, expected %d",
+            (int)numBits, (int)i, fields[i], expected);
+        }
+      }
+    }
+    return (bitstream.getRemainingBits() == referenceBitstream.getRemainingBits());
+  }
+
+  // Peeking shouldn't consume bits, and skipping should land on the same data as reading
+  TestResult testPeekAndSkip() {
+    std::vector<uint8_t> bytes = TestRandom(12345).makeBytes(64);
+    BitstreamReader bitstream(bytes);
+    size_t bitOffset = 0;
+    for (size_t i=0; bitOffset < 400; ++i) {
+      size_t numBits = 1 + (i * 5) % 12;
+      int expected = getReferenceBits(bytes, bitOffset, numBits);
+      if (bitstream.peekBits(numBits) != expected || bitstream.peekBits(numBits) != expected) {
+        return string_format("Peek mismatch at offset %d", (int)bitOffset);
+      }
+      // Alternate between skipping small and large (multi-word) distances
+      size_t numSkipBits = (i % 4 == 3 ? 70 + i : numBits);
+      bitstream.skipBits(numSkipBits);
+      bitOffset += numSkipBits;
+      if (bitstream.getRemainingBits() != bytes.size() * 8 - bitOffset) {
+        return string_format("Wrong remaining bits after skipping to offset %d", (int)bitOffset);
+      }
+    }
+    // Peeking and skipping past the end
+    bitstream.skipBits(bytes.size() * 8);
+    return (bitstream.peekBits(32) == 0 && bitstream.getRemainingBits() == 0);
+  }
+
+  TestResult testSeekAndAlign() {
+    std::vector<uint8_t> bytes = TestRandom(12345).makeBytes(16);
+    BitstreamReader bitstream(bytes);
+    if (!bitstream.seekToBit(37) ||
+        bitstream.getBits(11) != getReferenceBits(bytes, 37, 11)) {
+      return "Seek to bit 37 failed";
+    }
+    if (!bitstream.alignTo(8) || bitstream.getRemainingBits() != 80 ||
+        bitstream.getBits(8) != bytes[6]) {
+      return "Byte alignment failed";
+    }
+    if (!bitstream.alignTo(8) || bitstream.getByteOffset() != 7) {
+      return "Aligning an aligned stream should not move";
+    }
+    if (bitstream.seekToBit(129) || bitstream.getByteOffset() != 7) {
+      return "Seeking past the end should fail without moving";
+    }
+    if (!bitstream.seekToBit(124) || bitstream.alignTo(48) || bitstream.getRemainingBits() != 4) {
+      return "Aligning past the end should fail without moving";
+    }
+    return (bitstream.seekToBit(0) && bitstream.getBits(8) == bytes[0]);
+  }
+
+  TestResult testBitMask() {
+    std::vector<uint8_t> bytes = {0xd3, 0x5a}; // 1101 0011 0101 1010
+    BitstreamReader bitstream(bytes);
+    BitstreamReader arrayBitstream(bytes);
+    for (size_t numBits : {4, 3, 1, 8}) {
+      uint32_t mask = bitstream.getBitMask(numBits);
+      std::vector<bool> flags = arrayBitstream.getBitArray(numBits);
+      for (size_t i=0; i<numBits; ++i) {
+        if (((mask >> i) & 0x1) != flags[i]) {
+          return string_format("Mask bit %d doesn't match bit array", (int)i);
+        }
+      }
+      if ((mask >> numBits) != 0) {
+        return "Mask has bits set beyond numBits";
+      }
+    }
+    return true;
+  }
+
+  // The unchecked reader should read the same bits when the content is guard padded
+  TestResult testUncheckedReads() {
+    std::vector<uint8_t> bytes = TestRandom(12345).makeBytes(61);
+    std::vector<uint8_t> padded = bytes;
+    padded.resize(bytes.size() + kBitstreamGuardBytes, 0);
+    UncheckedBitstreamReader bitstream(padded.data(), bytes.size());
+    size_t bitOffset = 0;
+    for (size_t i=0; bitOffset < bytes.size() * 8 + 64; ++i) {
+      size_t numBits = 1 + (i * 11) % 32;
+      int expected = getReferenceBits(bytes, bitOffset, numBits);
+      int actual = bitstream.getBits(numBits);
+      if (actual != expected) {
+        return string_format("Read %d bits at offset %d: got %d, expected %d",
+          (int)numBits, (int)bitOffset, actual, expected);
+      }
+      bitOffset += numBits;
+    }
+    return true;
+  }
+
+  // A reset reader should read new content as if newly constructed
+  TestResult testReset() {
+    std::vector<uint8_t> first = TestRandom(12345).makeBytes(20);
+    std::vector<uint8_t> second = TestRandom(12345).makeBytes(11);
+    BitstreamReader bitstream(first);
+    bitstream.getBits(13);
+    bitstream.skipBits(200);
+    bitstream.reset(second.data(), second.size());
+    BitstreamReader fresh(second);
+    if (bitstream.getRemainingBits() != 88 || bitstream.hasOverrun()) {
+      return "Wrong state after reset";
+    }
+    for (int i=0; i<9; ++i) {
+      if (bitstream.getBits(11) != fresh.getBits(11)) {
+        return "Wrong bits after reset";
+      }
+    }
+    return bitstream.hasOverrun();
+  }
+
+  // Overrun is only reported once bits past the end are consumed, not peeked
+  TestResult testOverrun() {
+    std::vector<uint8_t> bytes = TestRandom(12345).makeBytes(4);
+    bytes.resize(bytes.size() + kBitstreamGuardBytes, 0);
+    BitstreamReader checked(bytes.data(), 4);
+    UncheckedBitstreamReader unchecked(bytes.data(), 4);
+    IBitstreamReader* readers[2] = { &checked, &unchecked };
+    for (IBitstreamReader* bitstream : readers) {
+      bitstream->getBits(30);
+      bitstream->peekBits(8);
+      if (bitstream->hasOverrun()) {
+        return "Overrun reported before reaching the end";
+      }
+      bitstream->getBits(2);
+      if (bitstream->hasOverrun()) {
+        return "Overrun reported at exactly the end";
+      }
+      bitstream->getBit();
+      if (!bitstream->hasOverrun()) {
+        return "Overrun not reported after reading past the end";
+      }
+    }
+    return true;
+  }
+
+} // namespace
+
+void addBitstreamTests(TestRunner& runner) {
+  runner.add("bitstream reads of mixed sizes", testMixedSizeReads);
+  runner.add("bitstream reads past the end are zero", testReadPastEnd);
+  runner.add("bitstream signed reads", testSignedBits);
+  runner.add("bitstream signed bit fields", testSignedBitFields);
+  runner.add("bitstream peek and skip", testPeekAndSkip);
+  runner.add("bitstream seek and align", testSeekAndAlign);
+  runner.add("bitstream bit mask matches bit array", testBitMask);
+  runner.add("unchecked bitstream reads with guard padding", testUncheckedReads);
+  runner.add("bitstream overrun detection", testOverrun);
+  runner.add("bitstream reset", testReset);
+}
@@ -0,0 +1,47 @@
+#include "TestRunner.h"
+#include "util/FixedArray.h"
+
+namespace {
+
+  TestResult testResizeWithinCapacity() {
+    FixedArray<int, 4> values;
+    if (!values.empty() || values.capacity() != 4) {
+      return "New array should be empty with full capacity";
+    }
+    if (!values.assign(3, 7) || values.size() != 3 || values[2] != 7) {
+      return "Assign within capacity failed";
+    }
+    if (values.resize(5) || values.size() != 3) {
+      return "Resizing past the capacity should fail without changing the size";
+    }
+    // Shrinking and growing keeps the stored values
+    values.resize(1);
+    values.resize(3);
+    int sum = 0;
+    for (int v : values) {
+      sum += v;
+    }
+    return (sum == 21);
+  }
+
+  TestResult testEmplaceAndClear() {
+    struct Entry {
+      int a = 1;
+      int b = 2;
+    };
+    FixedArray<Entry, 2> entries;
+    entries.emplace_back().a = 5;
+    Entry& second = entries.emplace_back();
+    if (!entries.full() || entries[0].a != 5 || second.a != 1 || entries.back().b != 2) {
+      return "Emplaced entries should be default values";
+    }
+    entries.clear();
+    return (entries.empty() && entries.begin() == entries.end());
+  }
+
+} // namespace
+
+void addFixedArrayTests(TestRunner& runner) {
+  runner.add("fixed array resize within capacity", testResizeWithinCapacity);
+  runner.add("fixed array emplace and clear", testEmplaceAndClear);
+}
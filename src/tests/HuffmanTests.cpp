@@ -0,0 +1,121 @@
+#include "TestRunner.h"
+#include "BitWriter.h"
+#include "TestRandom.h"
+#include "atrac/AtracConstants.h"
+#include "util/HuffmanTable.h"
+#include "util/StringUtil.h"
+
+namespace {
+
+  // Every code in the ATRAC3 tables should decode from a stream of concatenated codes
+  TestResult testDecodeAtracTables() {
+    Atrac3::Atrac3Constants constants;
+    for (size_t tableIndex=1; tableIndex<constants.huffmanTables.size(); ++tableIndex) {
+      const HuffmanTable& table = constants.huffmanTables[tableIndex];
+      const std::vector<HuffmanEntry>& entries = table.getEntries();
+
+      // Deterministic pseudo-random sequence of entries
+      BitWriter writer;
+      std::vector<int> expected;
+      TestRandom random(54321 + tableIndex);
+      for (int i=0; i<500; ++i) {
+        const HuffmanEntry& e = entries[(random.next() >> 16) % entries.size()];
+        writer.write(e.code, e.numBits);
+        expected.push_back(e.symbol);
+      }
+
+      BitstreamReader bitstream(writer.bytes);
+      std::vector<int> actual;
+      if (!table.readCodes(bitstream, (int)expected.size(), actual) || actual != expected) {
+        return string_format("Table %d decoded the wrong symbols", (int)tableIndex);
+      }
+      for (const HuffmanEntry& e : entries) {
+        int value = 0;
+        if (!table.contains(e.code, e.numBits, value) || value != e.symbol) {
+          return string_format("Table %d missing code %d", (int)tableIndex, e.code);
+        }
+      }
+    }
+    return true;
+  }
+
+  // An invalid code should consume the maximum code length and fail
+  TestResult testInvalidCode() {
+    HuffmanTable table({{1, 0, 5}, {2, 2, 6}}); // 0 -> 5, 10 -> 6, 11... is invalid
+    std::vector<uint8_t> bytes = {0x2f, 0xf0}; // 0 0 10 1111 1111 0000
+    BitstreamReader bitstream(bytes);
+    int a = 0, b = 0, c = 0, d = 0;
+    bool ok = table.readCode(bitstream, a) && table.readCode(bitstream, b) &&
+      table.readCode(bitstream, c);
+    if (!ok || a != 5 || b != 5 || c != 6) {
+      return "Valid codes decoded incorrectly";
+    }
+    if (table.readCode(bitstream, d) || d != 0 || bitstream.getRemainingBits() != 4) {
+      return "Invalid code should fail after consuming 8 bits";
+    }
+    int value = 0;
+    return (!table.contains(3, 2, value) && !table.contains(0, 2, value));
+  }
+
+  // Multi-symbol decoding should match decoding one code at a time, including the
+  // table 1 pair expansion and partial tails
+  TestResult testMultiSymbolValues() {
+    Atrac3::Atrac3Constants constants;
+    for (size_t tableIndex=1; tableIndex<constants.huffmanTables.size(); ++tableIndex) {
+      const HuffmanTable& table = constants.huffmanTables[tableIndex];
+      const std::vector<HuffmanEntry>& entries = table.getEntries();
+      int valuesPerSymbol = (tableIndex == 1 ? 2 : 1);
+
+      BitWriter writer;
+      std::vector<int> expected;
+      TestRandom random(2468 + tableIndex);
+      for (int i=0; i<301; ++i) {
+        const uint32_t state = random.next();
+        // Favor short codes, as in real spectra
+        size_t entryIndex = (state >> 16) % entries.size();
+        if ((state >> 28) < 12) {
+          entryIndex %= 3;
+        }
+        const HuffmanEntry& e = entries[entryIndex];
+        writer.write(e.code, e.numBits);
+        for (int j=0; j<valuesPerSymbol; ++j) {
+          expected.push_back(valuesPerSymbol == 1 ? e.symbol :
+            constants.vlcTable1Mantissas[e.symbol * 2 + j]);
+        }
+      }
+      // Drop the last value, to end on a partial pair for table 1
+      expected.pop_back();
+      int numValues = (int)expected.size();
+
+      BitstreamReader bitstream(writer.bytes);
+      std::vector<int> actual(expected.size(), 99);
+      if (table.readValues(bitstream, numValues, actual.data()) != numValues ||
+          actual != expected) {
+        return string_format("Table %d decoded the wrong values", (int)tableIndex);
+      }
+    }
+    return true;
+  }
+
+  // Multi-symbol decoding should stop at an invalid code after consuming 8 bits
+  TestResult testMultiSymbolInvalidCode() {
+    HuffmanTable table({{1, 0, 5}, {2, 2, 6}});
+    table.initMultiSymbol();
+    std::vector<uint8_t> bytes = {0x26, 0x00}; // 0 0 10 0 11000000 000
+    BitstreamReader bitstream(bytes);
+    int values[10] = {};
+    if (table.readValues(bitstream, 10, values) != 4) {
+      return "Wrong number of values before the invalid code";
+    }
+    return (values[0] == 5 && values[1] == 5 && values[2] == 6 && values[3] == 5 &&
+      bitstream.getRemainingBits() == 3);
+  }
+
+} // namespace
+
+void addHuffmanTests(TestRunner& runner) {
+  runner.add("huffman decode of atrac tables", testDecodeAtracTables);
+  runner.add("huffman invalid code", testInvalidCode);
+  runner.add("huffman multi-symbol values", testMultiSymbolValues);
+  runner.add("huffman multi-symbol invalid code", testMultiSymbolInvalidCode);
+}
@@ -0,0 +1,33 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Deterministic pseudo-random numbers for building test data, so failures are
+// reproducible. A linear congruential generator, whose upper bits are the most random.
+class TestRandom {
+public:
+  explicit TestRandom(uint32_t seed) : _state(seed) {}
+
+  // Advance and return the full 32-bit state
+  uint32_t next() {
+    _state = _state * 1103515245 + 12345;
+    return _state;
+  }
+
+  uint8_t nextByte() {
+    return static_cast<uint8_t>(next() >> 16);
+  }
+
+  std::vector<uint8_t> makeBytes(size_t numBytes) {
+    std::vector<uint8_t> result(numBytes);
+    for (uint8_t& b : result) {
+      b = nextByte();
+    }
+    return result;
+  }
+
+private:
+  uint32_t _state;
+};
@@ -1,6 +1,7 @@
 #include "CommandLineOptionsParser.h"
 #include "StringUtil.h"
 #include "Logging.h"
+#include <cstdlib>
 
 bool CommandLineOptionsParser::parse(int argn, char** argv) {
   constexpr const char* kLogCategory = "Options";
@@ -42,6 +43,16 @@ void CommandLineOptionsParser::add(const StringArray& flags, std::string& target
   }
 }
 
+void CommandLineOptionsParser::add(const StringArray& flags, int& targetParameter, const std::string& helpDescription) {
+  addHelp(flags, helpDescription);
+  Option o;
+  o.hasParam = true;
+  o.paramCallback = [&](const char* s){targetParameter = std::atoi(s);};
+  for (const std::string& flag : flags) {
+    _options[flag] = o;
+  }
+}
+
 void CommandLineOptionsParser::add(const StringArray& flags, VoidFunction callback, const std::string& helpDescription) {
   addHelp(flags, helpDescription);
   Option o;
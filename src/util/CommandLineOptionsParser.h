@@ -16,6 +16,8 @@ class CommandLineOptionsParser {
 
     // Add a flag with parameter
     void add(const StringArray& flags, std::string& targetParameter, const std::string& helpDescription);
+    // Add a flag with an integer parameter (0 if not a number)
+    void add(const StringArray& flags, int& targetParameter, const std::string& helpDescription);
     // Add a no-parameter flag that triggers a callback
     void add(const StringArray& flags, VoidFunction callback, const std::string& helpDescription);
 
@@ -0,0 +1,66 @@
+#pragma once
+
+#include <cstddef>
+
+// An array with inline storage for up to kCapacity values and a variable size, for
+// data with a known maximum count. Resizing and clearing never allocate, so a
+// structure made of FixedArrays can be refilled repeatedly without heap traffic.
+//
+// All kCapacity values are always constructed. Growing the size exposes whatever
+// values were previously stored there, unless reinitialized with assign().
+template<typename T, size_t kCapacity>
+class FixedArray {
+  public:
+    using value_type = T;
+
+    static constexpr size_t capacity() { return kCapacity; }
+    size_t size() const { return _size; }
+    bool empty() const { return (_size == 0); }
+    bool full() const { return (_size == kCapacity); }
+
+    void clear() { _size = 0; }
+
+    // Set the size without changing any values.
+    // @return Whether successful. Fails without changing the size if n exceeds the capacity.
+    bool resize(size_t n) {
+      if (n > kCapacity) {
+        return false;
+      }
+      _size = n;
+      return true;
+    }
+
+    // Set the size, and set all values within it.
+    // @return Whether successful. Fails without changing anything if n exceeds the capacity.
+    bool assign(size_t n, const T& value) {
+      if (!resize(n)) {
+        return false;
+      }
+      for (size_t i=0; i<n; ++i) {
+        _values[i] = value;
+      }
+      return true;
+    }
+
+    // Append a default value and return it. The array must not be full().
+    T& emplace_back() {
+      _values[_size] = T();
+      return _values[_size++];
+    }
+
+    T& operator[](size_t i) { return _values[i]; }
+    const T& operator[](size_t i) const { return _values[i]; }
+    T& back() { return _values[_size-1]; }
+    const T& back() const { return _values[_size-1]; }
+
+    T* data() { return _values; }
+    const T* data() const { return _values; }
+    T* begin() { return _values; }
+    T* end() { return _values + _size; }
+    const T* begin() const { return _values; }
+    const T* end() const { return _values + _size; }
+
+  private:
+    T _values[kCapacity] = {};
+    size_t _size = 0;
+};
@@ -1,68 +1,114 @@
 #include "HuffmanTable.h"
 
+constexpr int HuffmanTable::kMaxCodeBits;
+constexpr int HuffmanTable::kMultiSymbolBits;
+constexpr int HuffmanTable::kMaxMultiSymbolValues;
+constexpr bool HuffmanTable::NoCodeLengthCounter::kIsCounting;
+
+namespace {
+  const HuffmanTable::LookupEntry kEmptyLookup[1 << HuffmanTable::kMaxCodeBits] = {};
+}
+
+HuffmanTable::HuffmanTable() : _lookup(kEmptyLookup) {
+}
+
 HuffmanTable::HuffmanTable(const std::vector<HuffmanEntry>& entries) {
   init(entries);
 }
 
-void HuffmanTable::init(const std::vector<HuffmanEntry>& entries) {
-  _entries = entries;
-  _values.clear();
-  int n = (int)entries.size();
-  for (int i=0; i<n; ++i) {
-    const HuffmanEntry& e = entries[i];
-    _values[e.numBits][e.code] = e.symbol;
-  }
+std::vector<HuffmanEntry> HuffmanTable::getEntries() const {
+  return std::vector<HuffmanEntry>(_entries, _entries + _numEntries);
 }
 
-bool HuffmanTable::contains(int code, int numBits, int& resultValue) const {
-  const auto iter1 = _values.find(numBits);
-  if (iter1 != _values.end()) {
-    const std::map<int, int>& codes = iter1->second;
-    const auto iter2 = codes.find(code);
-    if (iter2 != codes.end()) {
-      resultValue = iter2->second;
-      return true;
+void HuffmanTable::init(const std::vector<HuffmanEntry>& entries) {
+  _ownedEntries = entries;
+  _ownedLookup.assign(1 << kMaxCodeBits, LookupEntry());
+  _ownedMultiSymbolLookup.clear();
+  _ownedSymbolValues.clear();
+  _entries = _ownedEntries.data();
+  _numEntries = _ownedEntries.size();
+  _lookup = _ownedLookup.data();
+  _multiSymbolLookup = nullptr;
+  _valuesPerSymbol = 1;
+  _symbolValues = nullptr;
+
+  // Fill longer codes first, so that if a table isn't prefix-free, the shortest
+  // matching code wins, as when reading bit by bit.
+  for (int numBits=kMaxCodeBits; numBits >= 1; --numBits) {
+    for (const HuffmanEntry& e : entries) {
+      if (e.numBits != numBits || e.code < 0 || e.code >= (1 << numBits)) {
+        continue;
+      }
+      // Every window value that starts with this code decodes to it
+      int numUnusedBits = kMaxCodeBits - numBits;
+      int first = e.code << numUnusedBits;
+      int last = first + (1 << numUnusedBits);
+      for (int i=first; i<last; ++i) {
+        _ownedLookup[i].symbol = static_cast<int16_t>(e.symbol);
+        _ownedLookup[i].numBits = static_cast<uint8_t>(numBits);
+      }
     }
   }
-  return false;
 }
 
-bool HuffmanTable::readCode(IBitstreamReader& bitstream, int& resultValue) const {
-  constexpr int kMaxBits = 8;
-  int code = 0;
+void HuffmanTable::initMultiSymbol(int valuesPerSymbol, const std::vector<int>& symbolValues) {
+  _ownedSymbolValues = symbolValues;
+  _valuesPerSymbol = (symbolValues.empty() ? 1 : valuesPerSymbol);
+  _symbolValues = (symbolValues.empty() ? nullptr : _ownedSymbolValues.data());
+  _ownedMultiSymbolLookup.assign(1 << kMultiSymbolBits, MultiSymbolEntry());
+  _multiSymbolLookup = _ownedMultiSymbolLookup.data();
 
-  // Read the huffman code 1 bit at a time until it's a valid code
-  for (int numBits=1; numBits <= kMaxBits; ++numBits) {
-    code = (code << 1) + bitstream.getBit();
-    if (contains(code, numBits, resultValue)) {
-      return true;
+  constexpr int kWindowMask = (1 << kMultiSymbolBits) - 1;
+  for (int window=0; window < (1 << kMultiSymbolBits); ++window) {
+    MultiSymbolEntry& result = _ownedMultiSymbolLookup[window];
+    // Decode codes from the window while they fit entirely within it, and their
+    // values fit in the entry. Bits shifted in past the window are zero, but
+    // never part of an accepted code.
+    int numBits = 0;
+    while (numBits < kMultiSymbolBits) {
+      int next = ((window << numBits) & kWindowMask) >> (kMultiSymbolBits - kMaxCodeBits);
+      const LookupEntry& entry = _lookup[next];
+      if (entry.numBits == 0 || numBits + entry.numBits > kMultiSymbolBits ||
+          result.numValues + _valuesPerSymbol > kMaxMultiSymbolValues) {
+        break;
+      }
+      if (!_symbolValues) {
+        result.values[result.numValues++] = static_cast<int8_t>(entry.symbol);
+      } else {
+        const int* values = &_symbolValues[entry.symbol * _valuesPerSymbol];
+        for (int j=0; j<_valuesPerSymbol; ++j) {
+          result.values[result.numValues++] = static_cast<int8_t>(values[j]);
+        }
+      }
+      numBits += entry.numBits;
     }
+    result.numBits = static_cast<uint8_t>(numBits);
   }
-  resultValue = 0;
-  return false;
 }
 
-int HuffmanTable::readCode(IBitstreamReader& bitstream) const {
-  constexpr int kMaxBits = 8;
-  int resultValue = 0;
-  int code = 0;
-
-  // Read the huffman code 1 bit at a time until it's a valid code
-  for (int numBits=1; numBits<=kMaxBits; ++numBits) {
-    code = (code << 1) + bitstream.getBit();
-    if (contains(code, numBits, resultValue)) {
-      return resultValue;
-    }
-  }
-  return 0;
+void HuffmanTable::initStatic(const HuffmanEntry* entries, size_t numEntries,
+      const LookupEntry* lookup, const MultiSymbolEntry* multiSymbolLookup,
+      int valuesPerSymbol, const int* symbolValues) {
+  _ownedEntries.clear();
+  _ownedLookup.clear();
+  _ownedMultiSymbolLookup.clear();
+  _ownedSymbolValues.clear();
+  _entries = entries;
+  _numEntries = numEntries;
+  _lookup = lookup;
+  _multiSymbolLookup = multiSymbolLookup;
+  _valuesPerSymbol = (symbolValues ? valuesPerSymbol : 1);
+  _symbolValues = symbolValues;
 }
 
-bool HuffmanTable::readCodes(IBitstreamReader& bitstream, int numCodes, std::vector<int>& result) const {
-  result.resize(numCodes);
-  for (int i=0; i<numCodes; ++i) {
-    if (!readCode(bitstream, result[i])) {
-      return false;
-    }
+bool HuffmanTable::contains(int code, int numBits, int& resultValue) const {
+  if (numBits < 1 || numBits > kMaxCodeBits || code < 0 || code >= (1 << numBits)) {
+    return false;
+  }
+  const LookupEntry& entry = _lookup[code << (kMaxCodeBits - numBits)];
+  if (entry.numBits != numBits) {
+    return false;
   }
+  resultValue = entry.symbol;
   return true;
 }
@@ -1,6 +1,7 @@
 #pragma once
 
-#include <map>
+#include <cstddef>
+#include <cstdint>
 #include <vector>
 #include "io/Bitstream.h"
 
@@ -10,24 +11,195 @@ struct HuffmanEntry {
   int symbol; // output value
 };
 
+// Decoder for a prefix-free Huffman code of up to kMaxCodeBits bits.
+//
+// Decoding is table-driven: a flat lookup table is indexed by the next kMaxCodeBits
+// bits of the stream, giving the symbol and code length with a single probe. Codes
+// shorter than the window fill every lookup slot that starts with their bit pattern.
+//
+// The lookup tables are either built at runtime by init(), or prebuilt as static
+// arrays and referenced by initStatic() without any work or allocation.
 class HuffmanTable {
 public:
-  HuffmanTable() = default;
+  // Longest supported code, and the size of the lookup window in bits
+  static constexpr int kMaxCodeBits = 8;
+  // Window size and maximum number of values for the optional multi-symbol lookup
+  static constexpr int kMultiSymbolBits = 10;
+  static constexpr int kMaxMultiSymbolValues = 4;
+
+  // Symbol and code length for one lookup window value. numBits 0 marks an invalid code.
+  struct LookupEntry {
+    int16_t symbol;
+    uint8_t numBits;
+  };
+
+  // The decoded values of consecutive codes in one multi-symbol window. numValues 0
+  // means the first code is invalid.
+  struct MultiSymbolEntry {
+    int8_t values[kMaxMultiSymbolValues];
+    uint8_t numValues;
+    uint8_t numBits;
+  };
+
+  // Receives the length in bits of every code that readValues() consumes, or 0 for an
+  // invalid code. This one counts nothing, and compiles away entirely.
+  struct NoCodeLengthCounter {
+    // Whether codes are counted, so readValues() needs each code's own length
+    static constexpr bool kIsCounting = false;
+    void countCode(int /*numBits*/) const {}
+  };
+
+  // An empty table, where every code is invalid
+  HuffmanTable();
   HuffmanTable(const std::vector<HuffmanEntry>& entries);
 
-  const std::vector<HuffmanEntry>& getEntries() const { return _entries;}
+  // The lookup pointers may refer to owned storage, which moves along with the
+  // vectors, but would dangle in a copy
+  HuffmanTable(const HuffmanTable&) = delete;
+  HuffmanTable& operator=(const HuffmanTable&) = delete;
+  HuffmanTable(HuffmanTable&&) = default;
+  HuffmanTable& operator=(HuffmanTable&&) = default;
+
+  std::vector<HuffmanEntry> getEntries() const;
+
+  // The kMaxCodeBits lookup table, with (1 << kMaxCodeBits) entries
+  const LookupEntry* getLookup() const { return _lookup; }
+  // The kMultiSymbolBits lookup table, with (1 << kMultiSymbolBits) entries, or
+  // null if not enabled
+  const MultiSymbolEntry* getMultiSymbolLookup() const { return _multiSymbolLookup; }
 
   void init(const std::vector<HuffmanEntry>& entries);
   bool contains(int code, int numBits, int& resultValue) const;
 
-  bool readCode(IBitstreamReader& bitstream, int& outResult) const;
-  int readCode(IBitstreamReader& bitstream) const;
+  // Build a second lookup table, which decodes all complete codes within the next
+  // kMultiSymbolBits bits in one probe, for tables whose codes are mostly short.
+  // Must be called after init(). If symbolValues is given, each symbol expands into
+  // valuesPerSymbol values from symbolValues[symbol*valuesPerSymbol...] for
+  // readValues(), and must cover every symbol. Otherwise each symbol is its own value.
+  // Values must fit in int8_t.
+  void initMultiSymbol(int valuesPerSymbol = 1, const std::vector<int>& symbolValues = {});
+
+  // Reference prebuilt lookup tables, as generated from getLookup() and
+  // getMultiSymbolLookup() of an equivalent runtime-built table. Nothing is copied,
+  // so all arrays must outlive this table. multiSymbolLookup and symbolValues may
+  // be null.
+  void initStatic(const HuffmanEntry* entries, size_t numEntries,
+    const LookupEntry* lookup, const MultiSymbolEntry* multiSymbolLookup = nullptr,
+    int valuesPerSymbol = 1, const int* symbolValues = nullptr);
+
+  // The read functions are templated on the reader type, so that callers holding a
+  // concrete BitstreamReader avoid virtual dispatch per bit. IBitstreamReader works too.
+  // An invalid code consumes kMaxCodeBits bits and fails.
+  template<typename Reader>
+  bool readCode(Reader& bitstream, int& outResult) const;
+  template<typename Reader>
+  int readCode(Reader& bitstream) const;
 
   // Read consecutive values, and resize and fill the result array.
   // @return Whether all values were read successfully
-  bool readCodes(IBitstreamReader& bitstream, int numCodes, std::vector<int>& result) const;
+  template<typename Reader>
+  bool readCodes(Reader& bitstream, int numCodes, std::vector<int>& result) const;
+
+  // Read numValues values, applying the symbol expansion from initMultiSymbol(), and
+  // using the multi-symbol lookup while at least kMaxMultiSymbolValues values remain.
+  // Stops at an invalid code, after consuming kMaxCodeBits bits for it.
+  // The counter receives the length of each code read. A multi-symbol entry only has
+  // the total length of its codes, so a counting counter reads one code per lookup,
+  // which decodes the same values.
+  // @return The number of values written, which is numValues unless a code was invalid
+  template<typename Reader>
+  int readValues(Reader& bitstream, int numValues, int* result) const {
+    return readValues(bitstream, numValues, result, NoCodeLengthCounter());
+  }
+  template<typename Reader, typename CodeLengthCounter>
+  int readValues(Reader& bitstream, int numValues, int* result,
+    const CodeLengthCounter& counter) const;
 private:
-  // numBits -> code -> value
-  std::map<int, std::map<int, int>> _values;
-  std::vector<HuffmanEntry> _entries;
+  // Indexed by the next kMaxCodeBits bits of the stream
+  const LookupEntry* _lookup;
+  // Indexed by the next kMultiSymbolBits bits of the stream, null if not enabled
+  const MultiSymbolEntry* _multiSymbolLookup = nullptr;
+  int _valuesPerSymbol = 1;
+  // Null if symbols aren't expanded
+  const int* _symbolValues = nullptr;
+  const HuffmanEntry* _entries = nullptr;
+  size_t _numEntries = 0;
+
+  // Storage for tables built at runtime
+  std::vector<LookupEntry> _ownedLookup;
+  std::vector<MultiSymbolEntry> _ownedMultiSymbolLookup;
+  std::vector<int> _ownedSymbolValues;
+  std::vector<HuffmanEntry> _ownedEntries;
 };
+
+template<typename Reader>
+bool HuffmanTable::readCode(Reader& bitstream, int& resultValue) const {
+  const LookupEntry& entry = _lookup[bitstream.peekBits(kMaxCodeBits)];
+  if (entry.numBits == 0) {
+    bitstream.skipBits(kMaxCodeBits);
+    resultValue = 0;
+    return false;
+  }
+  bitstream.skipBits(entry.numBits);
+  resultValue = entry.symbol;
+  return true;
+}
+
+template<typename Reader>
+int HuffmanTable::readCode(Reader& bitstream) const {
+  int resultValue = 0;
+  readCode(bitstream, resultValue);
+  return resultValue;
+}
+
+template<typename Reader>
+bool HuffmanTable::readCodes(Reader& bitstream, int numCodes, std::vector<int>& result) const {
+  result.resize(numCodes);
+  for (int i=0; i<numCodes; ++i) {
+    if (!readCode(bitstream, result[i])) {
+      return false;
+    }
+  }
+  return true;
+}
+
+template<typename Reader, typename CodeLengthCounter>
+int HuffmanTable::readValues(Reader& bitstream, int numValues, int* result,
+    const CodeLengthCounter& counter) const {
+  int i = 0;
+  if (_multiSymbolLookup && !CodeLengthCounter::kIsCounting) {
+    // Every entry has room for the maximum number of values, so only the
+    // decoded ones are kept
+    while (numValues - i >= kMaxMultiSymbolValues) {
+      const MultiSymbolEntry& entry = _multiSymbolLookup[bitstream.peekBits(kMultiSymbolBits)];
+      if (entry.numValues == 0) {
+        break;
+      }
+      for (int j=0; j<kMaxMultiSymbolValues; ++j) {
+        result[i+j] = entry.values[j];
+      }
+      i += entry.numValues;
+      bitstream.skipBits(entry.numBits);
+    }
+  }
+
+  // The last few values, and invalid codes
+  while (i < numValues) {
+    const LookupEntry& entry = _lookup[bitstream.peekBits(kMaxCodeBits)];
+    counter.countCode(entry.numBits);
+    if (entry.numBits == 0) {
+      bitstream.skipBits(kMaxCodeBits);
+      return i;
+    }
+    bitstream.skipBits(entry.numBits);
+    if (!_symbolValues) {
+      result[i++] = entry.symbol;
+    } else {
+      const int* values = &_symbolValues[entry.symbol * _valuesPerSymbol];
+      for (int j=0; j<_valuesPerSymbol && i<numValues; ++j) {
+        result[i++] = values[j];
+      }
+    }
+  }
+  return i;
+}